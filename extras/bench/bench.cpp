@@ -0,0 +1,951 @@
+/*
+ * Bus traffic benchmark for the SSD1327 Grayscale driver library.
+ *
+ * Runs the library against the recording interface and reports the traffic
+ * every operation puts on the bus, modeled for common bus configurations.
+ * Compare the output between revisions to catch throughput regressions.
+ *
+ * Every operation also runs through the controller emulator and the image it
+ * would show is compared with the expected image, so an optimization that
+ * sends fewer bytes but the wrong pixels fails (exit status 1). Pass a
+ * directory as the first argument to save the emulated images as PGM files.
+ *
+ * Build and run from the repository root:
+ *
+ *   g++ -std=gnu++11 -O2 -pthread -Isrc -Iextras/host extras/bench/bench.cpp \
+ *     extras/host/ssd1327Mock.cpp extras/host/ssd1327Emulator.cpp \
+ *     extras/host/ssd1327ThreadDma.cpp \
+ *     src/ssd1327.cpp src/ssd1327FrameBuffer.cpp src/ssd1327Console.cpp \
+ *     src/ssd1327Pipeline.cpp src/ssd1327Strip.cpp src/ssd1327Text.cpp \
+ *     src/ssd1327Rle.cpp src/ssd1327Animation.cpp src/ssd1327Sprite.cpp \
+ *     -o bench && ./bench
+ *
+ * Add -DSSD1327_RLE_BUFFER=64 to decode the uneven widths of the compressed
+ * image scenarios a line at a time.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+#include "ssd1327.h"
+#include "ssd1327FrameBuffer.h"
+#include "ssd1327Console.h"
+#include "ssd1327Display.h"
+#include "ssd1327Pipeline.h"
+#include "ssd1327Strip.h"
+#include "ssd1327Text.h"
+#include "ssd1327Animation.h"
+#include "ssd1327Sprite.h"
+#include "fonts/dejaVuSansMono10.h"
+#include "fonts/dejaVuSans12.h"
+#include "ssd1327Mock.h"
+#include "ssd1327Emulator.h"
+#include "ssd1327ThreadDma.h"
+
+using namespace Ssd1327;
+
+typedef Implementation::ScrollSpeed ScrollSpeed;
+
+#define WIDTH 128
+#define HEIGHT 128
+// A smaller panel, centered in GDDRAM, for the rotation scenarios.
+#define SMALL_WIDTH 96
+#define SMALL_HEIGHT 64
+
+/**
+ * Bus for the compile time Display, records into the interface of the running
+ * scenario.
+ */
+struct RecorderBus {
+  RecordingInterface* recorder = nullptr;
+  void begin() {}
+  bool hwReset() { return false; }
+  uint8_t sendCommand(uint8_t* command, uint8_t len) {
+    return recorder->sendCommand(command, len);
+  }
+  uint8_t sendData(uint8_t* data, uint16_t len) {
+    return recorder->sendData(data, len);
+  }
+  void beginBurst() { recorder->beginBurst(); }
+  uint8_t endBurst() { return recorder->endBurst(); }
+};
+
+typedef Display<WIDTH, HEIGHT, RecorderBus> FixedDisplay;
+
+// Expected level of a pixel after the operation, -1 if it doesn't matter.
+typedef std::function<int16_t(uint8_t x, uint8_t y)> Expect;
+
+struct Scenario {
+  Scenario(
+    const char* name, std::function<void(MockImplementation&)> setup,
+    std::function<void(MockImplementation&)> run, Expect expect,
+    uint8_t width = WIDTH, uint8_t height = HEIGHT
+  ): name(name), setup(setup), run(run), expect(expect), width(width),
+    height(height) {}
+
+  const char* name;
+  // Runs before measuring, after the display is initialised.
+  std::function<void(MockImplementation&)> setup;
+  std::function<void(MockImplementation&)> run;
+  Expect expect;
+  // Size of the display.
+  uint8_t width;
+  uint8_t height;
+};
+
+static const struct {
+  const char* name;
+  BusModel model;
+} buses[] = {
+  {"I2C 400kHz/32", BusModel::i2c(400000, 32)},
+  {"I2C 1MHz/128", BusModel::i2c(1000000, 128)},
+  {"SPI 10MHz", BusModel::spi(10000000)},
+};
+
+// Deterministic test image, packed nibbles. Padded so implementations that
+// read a little too far don't read outside the allocation.
+static std::vector<uint8_t> makeImage(uint8_t width, uint8_t height) {
+  std::vector<uint8_t> image((width * height + 1) / 2 + 64);
+  for (size_t i = 0; i < image.size(); i++) image[i] = (uint8_t)(i * 37 + 11);
+  return image;
+}
+
+// Flat UI art: panels, a frame and a gradient bar on a plain background.
+static std::vector<uint8_t> makeUiImage(uint8_t width, uint8_t height) {
+  std::vector<uint8_t> image((width * height + 1) / 2);
+  for (uint32_t i = 0; i < (uint32_t)width * height; i++) {
+    uint8_t x = i % width;
+    uint8_t y = i / width;
+    uint8_t level = 0x1;
+    if (y < 14) level = 0x4;
+    if (x >= 8 && x < width - 8 && y >= 24 && y < 60) level = 0x9;
+    if ((x == 8 || x == width - 9) && y >= 24 && y < 60) level = 0xf;
+    if (y >= 70 && y < 78 && x >= 8 && x < 8 + 16 * 6) level = (x - 8) / 6;
+    if (i & 1) image[i / 2] |= level; else image[i / 2] |= level << 4;
+  }
+  return image;
+}
+
+// Same encoding as bin/convertimage --compress.
+static std::vector<uint8_t> rleEncode(const std::vector<uint8_t>& image,
+  uint32_t pixels) {
+  std::vector<uint8_t> out;
+  std::vector<uint8_t> literal;
+  auto level = [&image](uint32_t i) {
+    return (i & 1) ? image[i / 2] & 0x0f : image[i / 2] >> 4;
+  };
+  auto flush = [&out, &literal]() {
+    for (size_t start = 0; start < literal.size(); start += 128) {
+      size_t n = std::min<size_t>(128, literal.size() - start);
+      out.push_back(n - 1);
+      for (size_t i = 0; i < n; i += 2) {
+        uint8_t low = i + 1 < n ? literal[start + i + 1] : 0;
+        out.push_back(literal[start + i] << 4 | low);
+      }
+    }
+    literal.clear();
+  };
+  for (uint32_t i = 0; i < pixels;) {
+    uint32_t run = 1;
+    while (i + run < pixels && level(i + run) == level(i) && run < 264) run++;
+    if (run >= 5 || (run >= 3 && literal.empty())) {
+      flush();
+      if (run <= 8) {
+        out.push_back(0x80 | (run - 2) << 4 | level(i));
+      } else {
+        out.push_back(0xf0 | level(i));
+        out.push_back(run - 9);
+      }
+    } else {
+      for (uint32_t j = 0; j < run; j++) literal.push_back(level(i + j));
+    }
+    i += run;
+  }
+  flush();
+  return out;
+}
+
+/**
+ * Animation container of AnimationPlayer, like bin/convertimage --animation
+ * but with one rectangle around all changes of a frame.
+ */
+static std::vector<uint8_t> animationEncode(
+  const std::vector<std::vector<uint8_t>>& frames, uint8_t width,
+  uint8_t height, uint16_t delay) {
+  std::vector<uint8_t> out = {
+    width, height, (uint8_t)frames.size(), (uint8_t)(frames.size() >> 8)
+  };
+  uint8_t stride = width / 2;
+  for (size_t i = 0; i <= frames.size(); i++) {
+    const std::vector<uint8_t>& frame = frames[i % frames.size()];
+    uint8_t x0 = stride, y0 = height, x1 = 0, y1 = 0;
+    for (uint8_t y = 0; y < height; y++) {
+      for (uint8_t x = 0; x < stride; x++) {
+        uint32_t at = (uint32_t)y * stride + x;
+        if (i > 0 && frames[i - 1][at] == frame[at]) continue;
+        x0 = std::min(x0, x);
+        x1 = std::max(x1, x);
+        y0 = std::min(y0, y);
+        y1 = std::max(y1, y);
+      }
+    }
+    out.push_back(delay & 0xff);
+    out.push_back(delay >> 8);
+    out.push_back(x0 <= x1 ? 1 : 0);
+    if (x0 > x1) continue;
+    std::vector<uint8_t> rect;
+    for (uint8_t y = y0; y <= y1; y++) {
+      const uint8_t* line = frame.data() + (uint32_t)y * stride;
+      rect.insert(rect.end(), line + x0, line + x1 + 1);
+    }
+    uint8_t w = (x1 - x0 + 1) * 2;
+    uint8_t h = y1 - y0 + 1;
+    std::vector<uint8_t> data = rleEncode(rect, (uint32_t)w * h);
+    out.insert(out.end(), {
+      (uint8_t)(x0 * 2), y0, w, h, (uint8_t)data.size(),
+      (uint8_t)(data.size() >> 8)
+    });
+    out.insert(out.end(), data.begin(), data.end());
+  }
+  return out;
+}
+
+// Level of pixel x, y of a packed image with the given width.
+static uint8_t nibble(const std::vector<uint8_t>& image, uint8_t width,
+  uint8_t x, uint8_t y) {
+  uint32_t i = (uint32_t)y * width + x;
+  return (i & 1) ? image[i / 2] & 0x0f : image[i / 2] >> 4;
+}
+
+// Expect image at x, y, don't care about the rest of the display.
+static Expect imageAt(const std::vector<uint8_t>& image, uint8_t x0,
+  uint8_t y0, uint8_t width, uint8_t height) {
+  return [&image, x0, y0, width, height](uint8_t x, uint8_t y) -> int16_t {
+    if (x < x0 || y < y0 || x >= x0 + width || y >= y0 + height) return -1;
+    return nibble(image, width, x - x0, y - y0);
+  };
+}
+
+static Expect frameBuffer(FrameBuffer& frame) {
+  return [&frame](uint8_t x, uint8_t y) -> int16_t {
+    return frame.getPixel(x, y);
+  };
+}
+
+// Expect a frame flushed to a display rotated by degrees, portrait frames
+// for 90 and 270.
+static Expect rotatedFrame(FrameBuffer& frame, uint16_t degrees) {
+  return [&frame, degrees](uint8_t x, uint8_t y) -> int16_t {
+    uint8_t right = frame.getWidth() - 1;
+    uint8_t bottom = frame.getHeight() - 1;
+    switch (degrees) {
+      case 90: return frame.getPixel(y, bottom - x);
+      case 180: return frame.getPixel(right - x, bottom - y);
+      case 270: return frame.getPixel(right - y, x);
+      default: return frame.getPixel(x, y);
+    }
+  };
+}
+
+// Expect the lines of text on the display, as printed with the test font.
+static Expect text(const std::vector<std::string>& lines) {
+  const Font& font = dejaVuSansMono10;
+  return [&lines, &font](uint8_t x, uint8_t y) -> int16_t {
+    uint8_t row = y / font.height;
+    uint8_t column = x / font.width;
+    if (row >= lines.size() || column >= WIDTH / font.width) return 0;
+    char c = column < lines[row].size() ? lines[row][column] : ' ';
+    uint32_t glyph = (uint32_t)(c - font.first) * font.width * font.height;
+    uint32_t i = glyph + (y % font.height) * font.width + x % font.width;
+    return (i & 1) ? font.bits[i / 2] & 0x0f : font.bits[i / 2] >> 4;
+  };
+}
+
+static Expect fixedDisplay(FixedDisplay& display) {
+  return [&display](uint8_t x, uint8_t y) -> int16_t {
+    return display.getPixel(x, y);
+  };
+}
+
+// Point the fixed display at the scenario's recorder and initialise it.
+static void useFixed(FixedDisplay& fixed, MockImplementation& d) {
+  fixed.getBus().recorder = (RecordingInterface*)d.interface;
+  fixed.init();
+}
+
+/**
+ * Pixel at a time reference of the FrameBuffer drawing primitives, the span
+ * based primitives have to produce exactly the same pixels.
+ */
+struct Canvas {
+  std::vector<int16_t> pixels = std::vector<int16_t>(WIDTH * HEIGHT, 0);
+
+  void plot(int x, int y, int16_t level) {
+    if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT) {
+      pixels[y * WIDTH + x] = level;
+    }
+  }
+  void fill(int x, int y, int width, int height, int16_t level) {
+    for (int j = y; j < y + height; j++) {
+      for (int i = x; i < x + width; i++) plot(i, j, level);
+    }
+  }
+  void line(int x0, int y0, int x1, int y1, uint8_t level) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    int a = steep ? y0 : x0, a1 = steep ? y1 : x1;
+    int b = steep ? x0 : y0, b1 = steep ? x1 : y1;
+    int da = abs(a1 - a), db = abs(b1 - b);
+    int sa = a < a1 ? 1 : -1;
+    int error = da / 2;
+    for (int i = 0; i <= da; i++, a += sa) {
+      steep ? plot(b, a, level) : plot(a, b, level);
+      error -= db;
+      if (error < 0) {
+        b += b < b1 ? 1 : -1;
+        error += da;
+      }
+    }
+  }
+  // Quarter circles around the corners of left, top, right, bottom.
+  void arcs(int left, int top, int right, int bottom, int r, bool filled,
+    uint8_t level) {
+    int x = 0, y = r, error = 1 - r;
+    while (x <= y) {
+      if (filled) {
+        fill(left - x, top - y, right - left + 2 * x + 1, 1, level);
+        fill(left - x, bottom + y, right - left + 2 * x + 1, 1, level);
+        fill(left - y, top - x, right - left + 2 * y + 1, 1, level);
+        fill(left - y, bottom + x, right - left + 2 * y + 1, 1, level);
+      } else {
+        plot(left - x, top - y, level);
+        plot(right + x, top - y, level);
+        plot(left - x, bottom + y, level);
+        plot(right + x, bottom + y, level);
+        plot(left - y, top - x, level);
+        plot(right + y, top - x, level);
+        plot(left - y, bottom + x, level);
+        plot(right + y, bottom + x, level);
+      }
+      if (error < 0) {
+        error += 2 * x + 3;
+      } else {
+        error += 2 * (x - y) + 5;
+        y--;
+      }
+      x++;
+    }
+  }
+  // Glyphs of a proportional font, overlapping glyphs keep the highest
+  // coverage. Only the glyph boxes are set.
+  void text(const ProportionalFont& font, int x, int y, const char* text,
+    uint8_t foreground, uint8_t background) {
+    std::vector<int> coverage(WIDTH * HEIGHT, -1);
+    for (const char* c = text; *c; c++) {
+      const FontGlyph& glyph = font.glyphs[*c - font.first];
+      int stride = (glyph.width + 1) / 2;
+      for (int j = 0; j < glyph.height; j++) {
+        for (int i = 0; i < glyph.width; i++) {
+          int px = x + glyph.left + i, py = y + glyph.top + j;
+          if (px < 0 || py < 0 || px >= WIDTH || py >= HEIGHT) continue;
+          uint8_t byte = font.atlas[glyph.offset + j * stride + i / 2];
+          int level = i % 2 ? byte & 0x0f : byte >> 4;
+          int& pixel = coverage[py * WIDTH + px];
+          if (level > pixel) pixel = level;
+        }
+      }
+      x += glyph.advance;
+      for (uint16_t k = 0; c[1] && k < font.kerningCount; k++) {
+        const FontKerning& pair = font.kerning[k];
+        if (pair.left == (uint8_t)c[0] && pair.right == (uint8_t)c[1]) {
+          x += pair.adjust;
+        }
+      }
+    }
+    for (int i = 0; i < WIDTH * HEIGHT; i++) {
+      if (coverage[i] < 0) continue;
+      int blend = (foreground - background) * coverage[i];
+      blend = blend < 0 ? (blend - 7) / 15 : (blend + 7) / 15;
+      pixels[i] = background + blend;
+    }
+  }
+  Expect expect() {
+    return [this](uint8_t x, uint8_t y) -> int16_t {
+      return pixels[y * WIDTH + x];
+    };
+  }
+};
+
+static Expect anything() {
+  return [](uint8_t, uint8_t) -> int16_t { return -1; };
+}
+
+static void noSetup(MockImplementation&) {}
+
+int main(int argc, char** argv) {
+  const char* pgmDir = argc > 1 ? argv[1] : nullptr;
+  int failures = 0;
+  std::vector<uint8_t> full = makeImage(WIDTH, HEIGHT);
+  std::vector<uint8_t> odd = makeImage(127, HEIGHT);
+  std::vector<uint8_t> glyph = makeImage(7, 9);
+  std::vector<uint8_t> ui = makeUiImage(WIDTH, HEIGHT);
+  std::vector<uint8_t> uiRle = rleEncode(ui, WIDTH * HEIGHT);
+  std::vector<uint8_t> oddUi = makeUiImage(127, 100);
+  std::vector<uint8_t> oddUiRle = rleEncode(oddUi, 127 * 100);
+  std::vector<uint8_t> wideUi = makeUiImage(125, 60);
+  std::vector<uint8_t> wideUiRle = rleEncode(wideUi, 125 * 60);
+  std::vector<uint8_t> noiseRle = rleEncode(full, WIDTH * HEIGHT);
+  // A spinner: a dot going round above a growing progress bar.
+  std::vector<std::vector<uint8_t>> spinner;
+  for (uint8_t i = 0; i < 8; i++) {
+    FrameBuffer spinnerFrame(WIDTH, 64);
+    spinnerFrame.fill(0x1);
+    static const int8_t dots[8][2] = {
+      {20, 0}, {14, 14}, {0, 20}, {-14, 14}, {-20, 0}, {-14, -14}, {0, -20},
+      {14, -14}
+    };
+    spinnerFrame.fillCircle(64 + dots[i][0], 28 + dots[i][1], 5, 0xf);
+    spinnerFrame.fillRect(8, 56, 8 + i * 14, 4, 0xa);
+    spinner.emplace_back(
+      spinnerFrame.getBuffer(),
+      spinnerFrame.getBuffer() + spinnerFrame.getSize()
+    );
+  }
+  std::vector<uint8_t> spinnerAnimation =
+    animationEncode(spinner, WIDTH, 64, 40);
+  // Cursor with a transparent (0) outside, uneven size.
+  std::vector<uint8_t> cursor = makeImage(15, 11);
+  for (uint8_t y = 0; y < 11; y++) {
+    for (uint8_t x = 0; x < 15; x++) {
+      uint32_t i = y * 15 + x;
+      uint8_t level = (x + y) % 5 == 0 || x > 11 - y / 2 ? 0 : 1 + i % 15;
+      cursor[i / 2] = (i & 1) ? (cursor[i / 2] & 0xf0) | level :
+        (cursor[i / 2] & 0x0f) | level << 4;
+    }
+  }
+  std::vector<uint8_t> cursorUnder((15 * 11 + 1) / 2);
+  FrameBuffer spriteFrame(WIDTH, HEIGHT);
+  Sprite cursorSprite(15, 11, cursor.data(), 0, cursorUnder.data());
+  FrameBuffer frame(WIDTH, HEIGHT);
+  FrameBuffer diffFrame(WIDTH, HEIGHT);
+  diffFrame.enableDoubleBuffering();
+  FrameBuffer shadow(WIDTH, HEIGHT);
+  FrameBuffer fillShadow(WIDTH, HEIGHT);
+  FrameBuffer scrollShadow(WIDTH, HEIGHT);
+  scrollShadow.enableDoubleBuffering();
+  FrameBuffer asyncFrame(WIDTH, HEIGHT);
+  FrameBuffer pipelineFirst(WIDTH, HEIGHT);
+  FrameBuffer pipelineSecond(WIDTH, HEIGHT);
+  FramePipeline* pipeline = nullptr;
+  FrameBuffer band(WIDTH, 16);
+  FrameBuffer shapes(WIDTH, HEIGHT);
+  // Portrait frames for a display turned by 90 and 270 degrees.
+  FrameBuffer turned(HEIGHT, WIDTH);
+  FrameBuffer turnedDiff(HEIGHT, WIDTH);
+  turnedDiff.enableDoubleBuffering();
+  std::vector<uint8_t> small = makeImage(SMALL_WIDTH, SMALL_HEIGHT);
+  std::vector<uint8_t> smallTurned = makeImage(SMALL_HEIGHT, SMALL_WIDTH);
+  FrameBuffer smallFrame(SMALL_WIDTH, SMALL_HEIGHT);
+  FrameBuffer smallPortrait(SMALL_HEIGHT, SMALL_WIDTH);
+  Canvas canvas;
+  FrameBuffer textFrame(WIDTH, HEIGHT);
+  Canvas textCanvas;
+  Canvas textDirect;
+  Canvas marquee;
+  // A band wider than the display, the part from x 64 on is shown.
+  FrameBuffer wideText(200, 32);
+  std::vector<uint8_t> wideWindow(WIDTH * 32 / 2);
+  Canvas wideCanvas;
+  TextRenderer textRenderer(&dejaVuSans12);
+  // The included font has no kerning, pull a few pairs together.
+  static const FontKerning pairs[] = {{'A', 'V', -2}, {'T', 'o', -2}};
+  ProportionalFont kerned = dejaVuSans12;
+  kerned.kerning = pairs;
+  kerned.kerningCount = 2;
+  TextRenderer kernedRenderer(&kerned);
+  std::vector<uint8_t> stripImages[2] = {full, glyph};
+  Console* console = nullptr;
+  FixedDisplay* fixed = new FixedDisplay();
+  std::vector<std::string> consoleLines;
+  // Emulator of the running scenario, to let time pass while scrolling.
+  Emulator* emulated = nullptr;
+
+  std::vector<Scenario> scenarios = {
+    {"init()", noSetup, [](MockImplementation& d) { d.init(); }, anything()},
+    {"clear()", noSetup, [](MockImplementation& d) { d.clear(); },
+      [](uint8_t, uint8_t) -> int16_t { return 0; }},
+    {"fillRect 40x30 level 9", noSetup, [](MockImplementation& d) {
+      d.fillRect(11, 20, 40, 30, 0x9);
+    }, [](uint8_t x, uint8_t y) -> int16_t {
+      if (x < 11 || y < 20 || x >= 51 || y >= 50) return -1;
+      return 0x9;
+    }},
+    {"fillRect shadowed", [&](MockImplementation& d) {
+      fillShadow.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      fillShadow.flush(&d);
+      d.setShadowBuffer(&fillShadow);
+    }, [](MockImplementation& d) {
+      d.fillRect(11, 20, 40, 30, 0x9);
+      d.fillRect(60, 70, 1, 5, 0x3);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (x >= 11 && y >= 20 && x < 51 && y < 50) return 0x9;
+      if (x == 60 && y >= 70 && y < 75) return 0x3;
+      return nibble(full, WIDTH, x, y);
+    }},
+    {"renderImageData 128x128", noSetup, [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, full.data(), WIDTH * HEIGHT / 2);
+    }, imageAt(full, 0, 0, WIDTH, HEIGHT)},
+    {"renderImageData 127x128", noSetup, [&](MockImplementation& d) {
+      d.renderImageData(0, 0, 127, HEIGHT, odd.data(), (127 * HEIGHT + 1) / 2);
+    }, imageAt(odd, 0, 0, 127, HEIGHT)},
+    {"renderImageData 7x9 glyph", noSetup, [&](MockImplementation& d) {
+      d.renderImageData(10, 20, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+    }, imageAt(glyph, 10, 20, 7, 9)},
+    {"renderImageData glyph again", [&](MockImplementation& d) {
+      d.renderImageData(10, 20, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+    }, [&](MockImplementation& d) {
+      // Same window, the register cache skips the window setup.
+      d.renderImageData(10, 20, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+    }, imageAt(glyph, 10, 20, 7, 9)},
+    {"renderImageData glyph odd x", noSetup, [&](MockImplementation& d) {
+      d.renderImageData(11, 20, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+    }, imageAt(glyph, 11, 20, 7, 9)},
+    {"renderImageData shadowed", [&](MockImplementation& d) {
+      shadow.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      shadow.flush(&d);
+      d.setShadowBuffer(&shadow);
+    }, [&](MockImplementation& d) {
+      // The pixels next to the glyph share its edge segments.
+      d.renderImageData(11, 20, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+      d.renderImageData(31, 40, 8, 9, glyph.data(), (8 * 9 + 1) / 2);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (x >= 11 && x < 18 && y >= 20 && y < 29) {
+        return nibble(glyph, 7, x - 11, y - 20);
+      }
+      if (x >= 31 && x < 39 && y >= 40 && y < 49) {
+        return nibble(glyph, 8, x - 31, y - 40);
+      }
+      return nibble(full, WIDTH, x, y);
+    }},
+    {"scroll left 3 steps", [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, full.data(), WIDTH * HEIGHT / 2);
+    }, [&](MockImplementation& d) {
+      d.setHorizontalScrollLeft(4, 20, 10, 40, ScrollSpeed::Frames_2);
+      d.activateScroll();
+      emulated->scroll(3);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (y < 10 || y > 40 || x < 8 || x > 41) return nibble(full, WIDTH, x, y);
+      // 17 columns of 2 pixels rotated left by 3 columns.
+      return nibble(full, WIDTH, 8 + (x - 8 + 6) % 34, y);
+    }},
+    {"scroll stop and resync", [&](MockImplementation& d) {
+      scrollShadow.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      scrollShadow.flush(&d);
+      d.setShadowBuffer(&scrollShadow);
+      d.setHorizontalScrollRight(4, 20, 10, 40, ScrollSpeed::Frames_2);
+      d.activateScroll();
+      emulated->scroll(5);
+    }, [&](MockImplementation& d) {
+      d.deactivateScroll();
+      scrollShadow.flush(&d);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      return nibble(full, WIDTH, x, y);
+    }},
+    {"scroll up 9 lines, draw", [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, full.data(), WIDTH * HEIGHT / 2);
+      d.scrollVertically(100);
+    }, [&](MockImplementation& d) {
+      // Moves the start line over the end of GDDRAM, the new line wraps.
+      d.scrollVertically(9, -1);
+      d.renderImageData(3, HEIGHT - 9, 7, 9, glyph.data(), (7 * 9 + 1) / 2);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (y < HEIGHT - 109) return nibble(full, WIDTH, x, y + 109);
+      if (y < HEIGHT - 9) return 0;
+      if (x >= 3 && x < 10) return nibble(glyph, 7, x - 3, y - (HEIGHT - 9));
+      return -1;
+    }},
+    {"scroll down 5 lines", [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, full.data(), WIDTH * HEIGHT / 2);
+    }, [&](MockImplementation& d) {
+      d.scrollVertically(-5, 0x7);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (y < 5) return 0x7;
+      return nibble(full, WIDTH, x, y - 5);
+    }},
+    {"console new line", [&](MockImplementation& d) {
+      delete console;
+      console = new Console(&d, &dejaVuSansMono10);
+      console->clear();
+      // Fills the screen, then scrolls and wraps.
+      for (int i = 0; i < 12; i++) console->printf("log line %d\n", i);
+      console->print("a line that is too long for one line\n");
+      consoleLines = {
+        "log line 6", "log line 7", "log line 8", "log line 9", "log line 10",
+        "log line 11", "a line that is too lo", "ng for one line",
+        "log line 12"
+      };
+    }, [&](MockImplementation&) {
+      console->printf("log line %d", 12);
+    }, text(consoleLines)},
+    {"Display<128,128> init()", [&](MockImplementation& d) {
+      fixed->getBus().recorder = (RecordingInterface*)d.interface;
+    }, [&](MockImplementation&) {
+      fixed->init();
+    }, [](uint8_t, uint8_t) -> int16_t { return 0; }},
+    {"Display<128,128> glyph odd x", [&](MockImplementation& d) {
+      useFixed(*fixed, d);
+    }, [&](MockImplementation&) {
+      fixed->renderImageData(11, 20, 7, 9, glyph.data(), glyph.size());
+    }, fixedDisplay(*fixed)},
+    {"Display<128,128> flush glyph", [&](MockImplementation& d) {
+      useFixed(*fixed, d);
+      fixed->drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      fixed->flush();
+    }, [&](MockImplementation&) {
+      fixed->drawImage(10, 20, 7, 9, glyph.data());
+      fixed->flush();
+    }, fixedDisplay(*fixed)},
+    {"renderImageData UI 128x128", noSetup, [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, ui.data(), WIDTH * HEIGHT / 2);
+    }, imageAt(ui, 0, 0, WIDTH, HEIGHT)},
+    {"renderCompressedImage UI", noSetup, [&](MockImplementation& d) {
+      d.renderCompressedImage(
+        0, 0, WIDTH, HEIGHT, uiRle.data(), uiRle.size()
+      );
+    }, imageAt(ui, 0, 0, WIDTH, HEIGHT)},
+    {"renderCompressedImage 127x100", noSetup, [&](MockImplementation& d) {
+      d.renderCompressedImage(
+        1, 20, 127, 100, oddUiRle.data(), oddUiRle.size()
+      );
+    }, imageAt(oddUi, 1, 20, 127, 100)},
+    {"renderCompressedImage 125x60", noSetup, [&](MockImplementation& d) {
+      d.renderCompressedImage(
+        3, 60, 125, 60, wideUiRle.data(), wideUiRle.size()
+      );
+    }, imageAt(wideUi, 3, 60, 125, 60)},
+    {"renderCompressedImage noise", noSetup, [&](MockImplementation& d) {
+      d.renderCompressedImage(
+        0, 0, WIDTH, HEIGHT, noiseRle.data(), noiseRle.size()
+      );
+    }, imageAt(full, 0, 0, WIDTH, HEIGHT)},
+    {"AnimationPlayer 8 frame loop", noSetup, [&](MockImplementation& d) {
+      // Two rounds at 25 fps, the second round starts with the delta back to
+      // the first frame.
+      AnimationPlayer player(
+        &d, spinnerAnimation.data(), spinnerAnimation.size()
+      );
+      player.setPosition(0, 32);
+      for (uint32_t now = 0; now < 16 * 40; now += 5) player.update(now);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (y < 32 || y >= 96) return -1;
+      return nibble(spinner[7], WIDTH, x, y - 32);
+    }},
+    {"Sprite move 8 frames", [&](MockImplementation& d) {
+      spriteFrame.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      cursorSprite.moveTo(-5, 3);
+      cursorSprite.draw(&spriteFrame);
+      spriteFrame.flush(&d);
+    }, [&](MockImplementation& d) {
+      // Every frame only the union of the old and new position is sent.
+      for (int16_t i = 1; i <= 8; i++) {
+        cursorSprite.moveTo(-5 + i * 7, 3 + i * 5);
+        cursorSprite.draw(&spriteFrame);
+        spriteFrame.flush(&d);
+      }
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      int16_t sx = x - 51;
+      int16_t sy = y - 43;
+      if (sx >= 0 && sy >= 0 && sx < 15 && sy < 11) {
+        uint8_t level = nibble(cursor, 15, sx, sy);
+        if (level != 0) return level;
+      }
+      return nibble(full, WIDTH, x, y);
+    }},
+    {"FrameBuffer flush 7x9 glyph", [&](MockImplementation& d) {
+      frame.markAllDirty();
+      frame.flush(&d);
+    }, [&](MockImplementation& d) {
+      frame.drawImage(10, 20, 7, 9, glyph.data());
+      frame.flush(&d);
+    }, frameBuffer(frame)},
+    {"FrameBuffer async flush", [&](MockImplementation& d) {
+      asyncFrame.markAllDirty();
+      asyncFrame.flush(&d);
+    }, [&](MockImplementation& d) {
+      // DMA at the speed of SPI at 10MHz, the CPU polls until it's done.
+      ThreadDmaInterface dma(d.interface, 1250000);
+      Interface* blocking = d.interface;
+      d.interface = &dma;
+      asyncFrame.drawImage(10, 20, 7, 9, glyph.data());
+      asyncFrame.fillRect(0, 100, WIDTH, 4, 0xa);
+      if (asyncFrame.flushAsync(&d) == 0) {
+        while (asyncFrame.isFlushing()) {}
+      }
+      d.interface = blocking;
+    }, frameBuffer(asyncFrame)},
+    {"FramePipeline 4 frames", [&](MockImplementation& d) {
+      delete pipeline;
+      pipeline = new FramePipeline(&d, &pipelineFirst, &pipelineSecond);
+      pipeline->getFrame()->fillRect(0, 0, WIDTH, HEIGHT, 0x3);
+      pipeline->swap();
+      pipeline->finish();
+    }, [&](MockImplementation& d) {
+      ThreadDmaInterface dma(d.interface, 1250000);
+      Interface* blocking = d.interface;
+      d.interface = &dma;
+      // A glyph moving right, every frame erases it and draws it again while
+      // the frame before is sent.
+      for (uint8_t i = 0; i < 4; i++) {
+        FrameBuffer* frame = pipeline->getFrame();
+        if (i > 0) frame->fillRect(10 + (i - 1) * 5, 20, 7, 9, 0x3);
+        frame->drawImage(10 + i * 5, 20, 7, 9, glyph.data());
+        pipeline->swap();
+      }
+      pipeline->finish();
+      d.interface = blocking;
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (x >= 25 && y >= 20 && x < 32 && y < 29) {
+        return nibble(glyph, 7, x - 25, y - 20);
+      }
+      return 0x3;
+    }},
+    {"FrameBuffer primitives", [&](MockImplementation& d) {
+      shapes.markAllDirty();
+      shapes.flush(&d);
+    }, [&](MockImplementation& d) {
+      shapes.drawLine(3, 5, 120, 40, 0xf);
+      canvas.line(3, 5, 120, 40, 0xf);
+      shapes.drawLine(100, 2, 90, 125, 0xe);
+      canvas.line(100, 2, 90, 125, 0xe);
+      shapes.drawLine(60, 60, 20, 100, 0xd);
+      canvas.line(60, 60, 20, 100, 0xd);
+      shapes.drawHLine(7, 120, 51, 0xc);
+      canvas.fill(7, 120, 51, 1, 0xc);
+      shapes.drawVLine(1, 10, 100, 0xb);
+      canvas.fill(1, 10, 1, 100, 0xb);
+      shapes.drawRect(11, 50, 30, 20, 0xa);
+      canvas.fill(11, 50, 30, 1, 0xa);
+      canvas.fill(11, 69, 30, 1, 0xa);
+      canvas.fill(11, 50, 1, 20, 0xa);
+      canvas.fill(40, 50, 1, 20, 0xa);
+      shapes.fillCircle(64, 64, 20, 0x9);
+      canvas.arcs(64, 64, 64, 64, 20, true, 0x9);
+      shapes.drawCircle(64, 64, 25, 0x8);
+      canvas.arcs(64, 64, 64, 64, 25, false, 0x8);
+      // Partly outside the display.
+      shapes.drawCircle(4, 120, 13, 0x7);
+      canvas.arcs(4, 120, 4, 120, 13, false, 0x7);
+      shapes.fillCircle(125, 3, 9, 0x6);
+      canvas.arcs(125, 3, 125, 3, 9, true, 0x6);
+      shapes.drawRoundRect(70, 95, 45, 25, 6, 0x5);
+      canvas.fill(76, 95, 33, 1, 0x5);
+      canvas.fill(76, 119, 33, 1, 0x5);
+      canvas.fill(70, 101, 1, 13, 0x5);
+      canvas.fill(114, 101, 1, 13, 0x5);
+      canvas.arcs(76, 101, 108, 113, 6, false, 0x5);
+      shapes.fillRoundRect(15, 75, 31, 16, 5, 0x4);
+      canvas.fill(15, 80, 31, 6, 0x4);
+      canvas.arcs(20, 80, 40, 85, 5, true, 0x4);
+      shapes.flush(&d);
+    }, canvas.expect()},
+    {"TextRenderer draw", [&](MockImplementation& d) {
+      textFrame.markAllDirty();
+      textFrame.flush(&d);
+      textCanvas.fill(0, 0, WIDTH, HEIGHT, -1);
+    }, [&](MockImplementation& d) {
+      textRenderer.setColors(0xf, 0x0);
+      textRenderer.draw(&textFrame, 2, 4, "Hello, World!");
+      textCanvas.text(dejaVuSans12, 2, 4, "Hello, World!", 0xf, 0x0);
+      textRenderer.setColors(0x3, 0xc);
+      textRenderer.draw(&textFrame, 7, 30, "jQuery {fly}");
+      textCanvas.text(dejaVuSans12, 7, 30, "jQuery {fly}", 0x3, 0xc);
+      kernedRenderer.draw(&textFrame, 11, 60, "AVATAR Tokyo");
+      textCanvas.text(kerned, 11, 60, "AVATAR Tokyo", 0xf, 0x0);
+      textFrame.flush(&d);
+    }, textCanvas.expect()},
+    {"TextRenderer render", [&](MockImplementation&) {
+      textDirect.fill(0, 0, WIDTH, HEIGHT, -1);
+    }, [&](MockImplementation& d) {
+      textRenderer.setColors(0xe, 0x1);
+      textRenderer.render(&d, 3, 90, "Proportional 4bpp text");
+      textDirect.text(dejaVuSans12, 3, 90, "Proportional 4bpp text", 0xe, 0x1);
+      textRenderer.setColors(0xf, 0x0);
+    }, textDirect.expect()},
+    {"TextRenderer render clipped", [&](MockImplementation&) {
+      marquee.fill(0, 0, WIDTH, HEIGHT, -1);
+    }, [&](MockImplementation& d) {
+      // A marquee scrolling out at the right edge, down to a 2 pixel box.
+      textRenderer.render(&d, 100, 40, "Marquee");
+      marquee.text(dejaVuSans12, 100, 40, "Marquee", 0xf, 0x0);
+      textRenderer.render(&d, 126, 10, "l");
+      marquee.text(dejaVuSans12, 126, 10, "l", 0xf, 0x0);
+    }, marquee.expect()},
+    {"TextRenderer draw wide frame", [&](MockImplementation&) {
+      wideCanvas.fill(0, 0, WIDTH, HEIGHT, -1);
+    }, [&](MockImplementation& d) {
+      const char* longText = "A line of text that is wider than the display";
+      textRenderer.draw(&wideText, 2, 10, longText);
+      wideText.readImage(64, 0, WIDTH, 32, wideWindow.data());
+      d.renderImageData(0, 50, WIDTH, 32, wideWindow.data(), wideWindow.size());
+      wideCanvas.text(dejaVuSans12, 2 - 64, 60, longText, 0xf, 0x0);
+    }, wideCanvas.expect()},
+    {"StripRenderer 16 line bands", noSetup, [&](MockImplementation& d) {
+      // The whole frame drawn in 8 passes through a 1K band, the glyph
+      // straddles two bands.
+      StripRenderer strips(&d, &band);
+      strips.render([](FrameBuffer* b, void* context) {
+        std::vector<uint8_t>* images = (std::vector<uint8_t>*)context;
+        b->drawImage(0, 0, WIDTH, HEIGHT, images[0].data());
+        b->drawImage(10, 28, 7, 9, images[1].data());
+      }, stripImages);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (x >= 10 && y >= 28 && x < 17 && y < 37) {
+        return nibble(glyph, 7, x - 10, y - 28);
+      }
+      return nibble(full, WIDTH, x, y);
+    }},
+    {"FrameBuffer diff flush redraw", [&](MockImplementation& d) {
+      diffFrame.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      diffFrame.markAllDirty();
+      diffFrame.flush(&d);
+    }, [&](MockImplementation& d) {
+      // Immediate mode: redraw everything, one glyph actually changed.
+      diffFrame.drawImage(0, 0, WIDTH, HEIGHT, full.data());
+      diffFrame.drawImage(10, 20, 7, 9, glyph.data());
+      diffFrame.flush(&d);
+    }, frameBuffer(diffFrame)},
+    {"row range after partial write", noSetup, [&](MockImplementation& d) {
+      // Setting one range alone leaves the column pointer where it was, the
+      // same window set again afterwards must still be sent.
+      d.setColumnRange(0, 3);
+      d.setRowRange(0, 3);
+      d.sendData(full.data(), 5);
+      d.setRowRange(0, 3);
+      d.sendData(full.data(), 16);
+      d.setColumnRange(0, 3);
+      d.setRowRange(0, 3);
+      d.sendData(glyph.data(), 16);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      if (x >= 8 || y >= 4) return -1;
+      return nibble(glyph, 8, x, y);
+    }},
+    {"setRotation 180 image", [&](MockImplementation& d) {
+      d.setRotation(180);
+    }, [&](MockImplementation& d) {
+      d.renderImageData(0, 0, WIDTH, HEIGHT, full.data(), full.size());
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      return nibble(full, WIDTH, WIDTH - 1 - x, HEIGHT - 1 - y);
+    }},
+    {"FrameBuffer flush at 90", [&](MockImplementation& d) {
+      d.setRotation(90);
+      turned.drawImage(0, 0, HEIGHT, WIDTH, full.data());
+    }, [&](MockImplementation& d) {
+      // Large, sent a panel column at a time with vertical address increment.
+      turned.markAllDirty();
+      turned.flush(&d);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      return nibble(full, HEIGHT, y, WIDTH - 1 - x);
+    }},
+    {"FrameBuffer diff flush at 270", [&](MockImplementation& d) {
+      d.setRotation(270);
+      turnedDiff.drawImage(0, 0, HEIGHT, WIDTH, full.data());
+      turnedDiff.flush(&d);
+    }, [&](MockImplementation& d) {
+      // Small, transposed in blocks of panel rows.
+      turnedDiff.drawImage(0, 0, HEIGHT, WIDTH, full.data());
+      turnedDiff.drawImage(10, 21, 7, 9, glyph.data());
+      turnedDiff.flush(&d);
+    }, [&](uint8_t x, uint8_t y) -> int16_t {
+      uint8_t tx = HEIGHT - 1 - y;
+      if (tx >= 10 && x >= 21 && tx < 17 && x < 30) {
+        return nibble(glyph, 7, tx - 10, x - 21);
+      }
+      return nibble(full, HEIGHT, tx, x);
+    }},
+  };
+  // A 96x64 panel at every rotation, 180 and 270 move the columns to the
+  // other side of GDDRAM. The whole frame goes out, then a glyph.
+  static const struct {
+    const char* name;
+    uint16_t degrees;
+  } smallRotations[] = {
+    {"96x64 flush at 0", 0},
+    {"96x64 flush at 90", 90},
+    {"96x64 flush at 180", 180},
+    {"96x64 flush at 270", 270},
+  };
+  for (const auto& rotation : smallRotations) {
+    uint16_t degrees = rotation.degrees;
+    bool portrait = degrees % 180 != 0;
+    FrameBuffer& frame = portrait ? smallPortrait : smallFrame;
+    std::vector<uint8_t>& image = portrait ? smallTurned : small;
+    scenarios.push_back(Scenario(rotation.name, [degrees](
+      MockImplementation& d
+    ) {
+      d.setRotation(degrees);
+    }, [&frame, &image, &glyph](MockImplementation& d) {
+      frame.drawImage(0, 0, frame.getWidth(), frame.getHeight(), image.data());
+      frame.markAllDirty();
+      frame.flush(&d);
+      frame.drawImage(5, 9, 7, 9, glyph.data());
+      frame.flush(&d);
+    }, rotatedFrame(frame, degrees), SMALL_WIDTH, SMALL_HEIGHT));
+  }
+
+  printf(
+    "%-30s %-14s %6s %6s %7s %6s %9s\n",
+    "operation", "bus", "calls", "trans", "wire B", "data B", "time us"
+  );
+  for (Scenario& scenario : scenarios) {
+    RecordingInterface recorder(Interface::InterfaceType::I2c);
+    MockImplementation display(scenario.width, scenario.height, &recorder);
+    Emulator emulator(scenario.width, scenario.height);
+    recorder.setListener(&emulator);
+    emulated = &emulator;
+    display.init();
+    scenario.setup(display);
+    recorder.clearEvents();
+    display.clearWaited();
+    scenario.run(display);
+    for (const auto& bus : buses) {
+      BusStats stats = recorder.getStats(bus.model);
+      printf(
+        "%-30s %-14s %6u %6u %7u %6u %9u\n",
+        scenario.name,
+        bus.name,
+        stats.commandCalls + stats.dataCalls,
+        stats.transactions,
+        stats.wireBytes,
+        stats.dataBytes,
+        stats.micros
+      );
+    }
+    if (display.getWaited() > 0) {
+      printf("%-30s waits %u ms\n", scenario.name, display.getWaited());
+    }
+    uint32_t wrong = 0;
+    for (uint8_t y = 0; y < scenario.height; y++) {
+      for (uint8_t x = 0; x < scenario.width; x++) {
+        int16_t expected = scenario.expect(x, y);
+        if (expected >= 0 && expected != emulator.getPixel(x, y)) wrong++;
+      }
+    }
+    if (wrong > 0) {
+      printf("%-30s FAILED: %u wrong pixels\n", scenario.name, wrong);
+      failures++;
+    }
+    if (pgmDir != nullptr) {
+      char path[256];
+      snprintf(path, sizeof(path), "%s/%s.pgm", pgmDir, scenario.name);
+      for (char* c = path + strlen(pgmDir) + 1; *c; c++) {
+        if (*c == ' ' || *c == '(' || *c == ')') *c = '_';
+      }
+      emulator.writePgm(path);
+    }
+  }
+  delete console;
+  delete fixed;
+  delete pipeline;
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,304 @@
+#include "ssd1327Emulator.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace Ssd1327;
+
+typedef Implementation::Cmd Cmd;
+typedef Implementation::Const Const;
+
+#define MODE_NORMAL  ((uint8_t)Cmd::SetDisplayNormal)
+#define MODE_ALL_ON  ((uint8_t)Cmd::SetDisplayAllOn)
+#define MODE_ALL_OFF ((uint8_t)Cmd::SetDisplayAllOff)
+#define MODE_INVERSE ((uint8_t)Cmd::SetDisplayInverse)
+#define VERTICAL_ADDRESS_INCREMENT 0b00000100
+
+// Number of argument bytes that follow a command byte.
+static uint8_t argumentCount(uint8_t command) {
+  switch ((Cmd)command) {
+    case Cmd::SetColumnRange:
+    case Cmd::SetRowRange:
+      return 2;
+    case Cmd::SetContrastLevel:
+    case Cmd::SetRemapping:
+    case Cmd::SetStartLine:
+    case Cmd::SetDisplayOffset:
+    case Cmd::SetMuxRatio:
+    case Cmd::EnableVddRegulator:
+    case Cmd::SetPhaseLength:
+    case Cmd::SetDisplayClock:
+    case Cmd::SetGpio:
+    case Cmd::SetSecondPrechargePeriod:
+    case Cmd::SetPreChargeVoltage:
+    case Cmd::SetComDeselectVoltage:
+    case Cmd::FunctionSelectionB:
+    case Cmd::McuProtectEnable:
+      return 1;
+    case Cmd::SetGrayscaleLevels:
+      return 15;
+    case Cmd::SetHorizontalScrollRight:
+    case Cmd::SetHorizontalScrollLeft:
+      return 7;
+    default:
+      return 0;
+  }
+}
+
+Emulator::Emulator(uint8_t width, uint8_t height):
+  Emulator(width, height, 0x51) {}
+
+Emulator::Emulator(
+  uint8_t width, uint8_t height, uint8_t referenceRemapping
+): _width(width), _height(height), _reference(referenceRemapping)
+{
+  // GDDRAM contents are undefined after power on, fill it with noise so
+  // operations that are expected to overwrite it can be verified.
+  uint32_t noise = 0x12345678;
+  for (uint16_t row = 0; row < SSD1327_GDDRAM_ROWS; row++) {
+    for (uint8_t column = 0; column < SSD1327_GDDRAM_COLUMNS; column++) {
+      noise = noise * 1103515245 + 12345;
+      _ram[row][column] = noise >> 16;
+    }
+  }
+  reset();
+}
+
+void Emulator::reset() {
+  _columnStart = 0;
+  _columnEnd = SSD1327_GDDRAM_COLUMNS - 1;
+  _rowStart = 0;
+  _rowEnd = SSD1327_GDDRAM_ROWS - 1;
+  _column = 0;
+  _row = 0;
+  _remapping = 0x00;
+  _startLine = 0;
+  _offset = 0;
+  _mux = SSD1327_GDDRAM_ROWS - 1;
+  _contrast = 0x7f;
+  _mode = MODE_NORMAL;
+  _on = false;
+  _locked = false;
+  _ignored = 0;
+  _scrollLeft = false;
+  _scrollRowStart = 0;
+  _scrollRowEnd = 0;
+  _scrollColumnStart = 0;
+  _scrollColumnEnd = 0;
+  _scrolling = false;
+  _received = 0;
+  _expected = 0;
+}
+
+void Emulator::onCommand(const uint8_t* command, uint16_t len) {
+  // Commands and their arguments form one stream, a command may be split over
+  // several calls and one call may hold several commands.
+  for (uint16_t i = 0; i < len; i++) {
+    if (_received == 0) {
+      _expected = argumentCount(command[i]);
+    }
+    _command[_received++] = command[i];
+    if (_received > _expected) {
+      _execute();
+      _received = 0;
+    }
+  }
+}
+
+void Emulator::onData(const uint8_t* data, uint16_t len) {
+  if (_locked) {
+    _ignored += len;
+    return;
+  }
+  for (uint16_t i = 0; i < len; i++) {
+    _write(data[i]);
+  }
+}
+
+void Emulator::_execute() {
+  uint8_t *arg = _command + 1;
+  if (_locked && (Cmd)_command[0] != Cmd::McuProtectEnable) {
+    _ignored += _received;
+    return;
+  }
+  switch ((Cmd)_command[0]) {
+    case Cmd::SetColumnRange:
+      _columnStart = _column = arg[0] & 0x3f;
+      _columnEnd = arg[1] & 0x3f;
+      break;
+    case Cmd::SetRowRange:
+      _rowStart = _row = arg[0] & 0x7f;
+      _rowEnd = arg[1] & 0x7f;
+      break;
+    case Cmd::SetContrastLevel:
+      _contrast = arg[0];
+      break;
+    case Cmd::SetRemapping:
+      _remapping = arg[0];
+      break;
+    case Cmd::SetStartLine:
+      _startLine = arg[0] & 0x7f;
+      break;
+    case Cmd::SetDisplayOffset:
+      _offset = arg[0] & 0x7f;
+      break;
+    case Cmd::SetMuxRatio:
+      // Values under 15 are invalid and ignored.
+      if ((arg[0] & 0x7f) >= 15) _mux = arg[0] & 0x7f;
+      break;
+    case Cmd::SetDisplayNormal:
+    case Cmd::SetDisplayAllOn:
+    case Cmd::SetDisplayAllOff:
+    case Cmd::SetDisplayInverse:
+      _mode = _command[0];
+      break;
+    case Cmd::DisplayOff:
+      _on = false;
+      break;
+    case Cmd::DisplayOn:
+      _on = true;
+      break;
+    case Cmd::SetHorizontalScrollRight:
+    case Cmd::SetHorizontalScrollLeft:
+      _scrollLeft = (Cmd)_command[0] == Cmd::SetHorizontalScrollLeft;
+      _scrollRowStart = arg[1] & 0x7f;
+      _scrollRowEnd = arg[3] & 0x7f;
+      _scrollColumnStart = arg[4] & 0x3f;
+      _scrollColumnEnd = arg[5] & 0x3f;
+      break;
+    case Cmd::ActivateScroll:
+      _scrolling = true;
+      break;
+    case Cmd::DectivateScroll:
+      _scrolling = false;
+      break;
+    case Cmd::McuProtectEnable:
+      _locked = (arg[0] & (uint8_t)Const::McuProtectLockMask) != 0;
+      break;
+    default:
+      // Timing, voltage and grayscale settings don't change the image.
+      break;
+  }
+}
+
+void Emulator::_write(uint8_t byte) {
+  uint8_t remap = _remapping ^ _reference;
+  uint8_t column = _column;
+  if (remap & (uint8_t)Const::GddrRemappingOnMask) {
+    column = SSD1327_GDDRAM_COLUMNS - 1 - column;
+  }
+  if (remap & (uint8_t)Const::NibbleRemappingOnMask) {
+    byte = byte << 4 | byte >> 4;
+  }
+  _ram[_row][column] = byte;
+
+  if (_remapping & VERTICAL_ADDRESS_INCREMENT) {
+    if (_row++ < _rowEnd) return;
+    _row = _rowStart;
+    if (_column++ < _columnEnd) return;
+    _column = _columnStart;
+  } else {
+    if (_column++ < _columnEnd) return;
+    _column = _columnStart;
+    if (_row++ < _rowEnd) return;
+    _row = _rowStart;
+  }
+}
+
+void Emulator::scroll(uint16_t steps) {
+  if (!_scrolling || _scrollColumnEnd < _scrollColumnStart) return;
+  uint8_t columns = _scrollColumnEnd - _scrollColumnStart + 1;
+  uint8_t shift = steps % columns;
+  if (!_scrollLeft) shift = (columns - shift) % columns;
+  uint8_t line[SSD1327_GDDRAM_COLUMNS];
+  for (uint8_t row = _scrollRowStart; row <= _scrollRowEnd; row++) {
+    uint8_t *ram = _ram[row] + _scrollColumnStart;
+    // Rotate left by shift columns.
+    for (uint8_t i = 0; i < columns; i++) {
+      line[i] = ram[(i + shift) % columns];
+    }
+    memcpy(ram, line, columns);
+  }
+}
+
+uint8_t Emulator::getPixel(uint8_t x, uint8_t y) {
+  if (x >= _width || y >= _height || !_on) return 0;
+  if (_mode == MODE_ALL_OFF) return 0;
+  if (_mode == MODE_ALL_ON) return 0x0f;
+  uint8_t remap = _remapping ^ _reference;
+  uint8_t line = y;
+  if (remap & (uint8_t)Const::ComSplitOddEvenOnMask) {
+    // Lines come out interleaved, the even lines from the top half of the
+    // rows, the odd lines from the bottom half.
+    line = (y % 2 == 0) ? y / 2 : _height / 2 + y / 2;
+  }
+  if (remap & (uint8_t)Const::ComRemappingOnMask) {
+    line = _height - 1 - line;
+  }
+  // Display offset moves the first line down, MUX limits the driven lines.
+  uint8_t driven = (line - _offset) & 0x7f;
+  if (driven > _mux) return 0;
+  uint8_t byte = _ram[(_startLine + driven) & 0x7f][x / 2];
+  uint8_t level = (x & 1) ? byte & 0x0f : byte >> 4;
+  if (_mode == MODE_INVERSE) level = 0x0f - level;
+  return level;
+}
+
+void Emulator::getImage(uint8_t* image) {
+  for (uint8_t y = 0; y < _height; y++) {
+    for (uint8_t x = 0; x < _width; x += 2) {
+      *image++ = getPixel(x, y) << 4 | getPixel(x + 1, y);
+    }
+  }
+}
+
+uint8_t Emulator::getRam(uint8_t column, uint8_t row) {
+  return _ram[row & 0x7f][column & 0x3f];
+}
+
+bool Emulator::writePgm(const char* path) {
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) return false;
+  fprintf(file, "P5\n%u %u\n15\n", _width, _height);
+  for (uint8_t y = 0; y < _height; y++) {
+    for (uint8_t x = 0; x < _width; x++) {
+      fputc(getPixel(x, y), file);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+uint8_t Emulator::getRemapping() {
+  return _remapping;
+}
+
+uint8_t Emulator::getStartLine() {
+  return _startLine;
+}
+
+uint8_t Emulator::getDisplayOffset() {
+  return _offset;
+}
+
+uint8_t Emulator::getMuxRatio() {
+  return _mux;
+}
+
+uint8_t Emulator::getContrastLevel() {
+  return _contrast;
+}
+
+bool Emulator::isDisplayOn() {
+  return _on;
+}
+
+bool Emulator::isLocked() {
+  return _locked;
+}
+
+bool Emulator::isScrolling() {
+  return _scrolling;
+}
+
+uint32_t Emulator::getIgnoredBytes() {
+  return _ignored;
+}
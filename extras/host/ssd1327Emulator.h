@@ -0,0 +1,122 @@
+/*
+ * Software model of the SSD1327 controller for the host. Interprets the
+ * command and data stream recorded by RecordingInterface, maintains a model
+ * of GDDRAM and renders the image the panel would show.
+ *
+ */
+#ifndef SSD1327_EMULATOR_H
+#define SSD1327_EMULATOR_H
+
+#include <stdint.h>
+#include "ssd1327.h"
+#include "ssd1327Mock.h"
+
+namespace Ssd1327 {
+
+/**
+ * SSD1327 emulator.
+ *
+ * Models the column and row address windows with auto increment in both
+ * horizontal and vertical address increment mode, the remapping bits, start
+ * line, display offset, MUX ratio, display modes, sleep, the MCU protection
+ * lock and horizontal scrolling (moved explicitly with `scroll`, the emulator
+ * has no notion of time).
+ *
+ * Panels are wired differently, so the remapping is modeled relative to a
+ * reference value: the remapping that shows the image upright on the panel
+ * (`Implementation::resetRemapping`, 0x51, by default). Column address and
+ * nibble remapping are applied when data is written, like the controller
+ * does, so changing them doesn't change the contents of GDDRAM. COM remapping
+ * and COM split are applied when the image is shown.
+ */
+class Emulator: public RecordingInterface::Listener {
+  public:
+    Emulator(uint8_t width, uint8_t height);
+    Emulator(uint8_t width, uint8_t height, uint8_t referenceRemapping);
+
+    void onCommand(const uint8_t* command, uint16_t len);
+    void onData(const uint8_t* data, uint16_t len);
+
+    /**
+     * Reset to the power on state of the controller, GDDRAM is not cleared
+     * (it's undefined after power on).
+     */
+    void reset();
+    /**
+     * Let time pass while scrolling is active: move the scroll area the given
+     * number of steps (one column each). Does nothing if not scrolling.
+     */
+    void scroll(uint16_t steps);
+
+    /**
+     * Grayscale level shown at a pixel, applies start line, offset, MUX,
+     * remapping and the display mode.
+     */
+    uint8_t getPixel(uint8_t x, uint8_t y);
+    /**
+     * Write the visible image as packed nibbles (same layout as a FrameBuffer)
+     * into image, width * height / 2 bytes.
+     */
+    void getImage(uint8_t* image);
+    /**
+     * Raw GDDRAM byte at a column address and row.
+     */
+    uint8_t getRam(uint8_t column, uint8_t row);
+    /**
+     * Save the visible image as a binary PGM (P5) file, max value 15.
+     * @return false if the file could not be written.
+     */
+    bool writePgm(const char* path);
+
+    uint8_t getRemapping();
+    uint8_t getStartLine();
+    uint8_t getDisplayOffset();
+    uint8_t getMuxRatio();
+    uint8_t getContrastLevel();
+    bool isDisplayOn();
+    bool isLocked();
+    bool isScrolling();
+    // Number of command and data bytes received while locked.
+    uint32_t getIgnoredBytes();
+
+  private:
+    uint8_t _width;
+    uint8_t _height;
+    uint8_t _reference;
+    uint8_t _ram[SSD1327_GDDRAM_ROWS][SSD1327_GDDRAM_COLUMNS];
+
+    uint8_t _columnStart;
+    uint8_t _columnEnd;
+    uint8_t _rowStart;
+    uint8_t _rowEnd;
+    uint8_t _column;
+    uint8_t _row;
+
+    uint8_t _remapping;
+    uint8_t _startLine;
+    uint8_t _offset;
+    uint8_t _mux;
+    uint8_t _contrast;
+    uint8_t _mode;
+    bool _on;
+    bool _locked;
+    uint32_t _ignored;
+
+    // Horizontal scroll setup, in GDDRAM columns and rows.
+    bool _scrollLeft;
+    uint8_t _scrollRowStart;
+    uint8_t _scrollRowEnd;
+    uint8_t _scrollColumnStart;
+    uint8_t _scrollColumnEnd;
+    bool _scrolling;
+
+    // Command being received, with its arguments.
+    uint8_t _command[16];
+    uint8_t _received;
+    uint8_t _expected;
+
+    void _execute();
+    void _write(uint8_t byte);
+};
+};
+#endif
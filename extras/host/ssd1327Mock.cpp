@@ -0,0 +1,159 @@
+#include "ssd1327Mock.h"
+
+using namespace Ssd1327;
+
+// Bits per byte on I2C, 8 data bits and an ACK.
+#define I2C_BITS_PER_BYTE 9
+// START and STOP condition together take about 2 bit times.
+#define I2C_START_STOP_BITS 2
+// Time to toggle CS# (and D/C#) around an SPI transaction with digitalWrite.
+#define SPI_TRANSACTION_OVERHEAD_NS 2000
+
+BusModel BusModel::i2c(uint32_t frequency, uint16_t bufferSize) {
+  BusModel model;
+  model.type = Interface::InterfaceType::I2c;
+  model.frequency = frequency;
+  model.bufferSize = bufferSize;
+  return model;
+}
+
+BusModel BusModel::spi(uint32_t frequency) {
+  BusModel model;
+  model.type = Interface::InterfaceType::Spi;
+  model.frequency = frequency;
+  model.bufferSize = 0;
+  return model;
+}
+
+RecordingInterface::RecordingInterface(InterfaceType interfaceType) {
+  type = (uint8_t)interfaceType;
+}
+
+void RecordingInterface::beginTransmission() {
+  _record(EventType::BeginTransmission, nullptr, 0);
+}
+
+uint8_t RecordingInterface::endTransmission() {
+  _record(EventType::EndTransmission, nullptr, 0);
+  return 0;
+}
+
+void RecordingInterface::write(uint8_t byte) {
+  _record(EventType::Write, &byte, 1);
+}
+
+uint8_t RecordingInterface::sendCommand(uint8_t command) {
+  return sendCommand(&command, 1);
+}
+
+uint8_t RecordingInterface::sendCommand(uint8_t* command, uint8_t len) {
+  _record(EventType::Command, command, len);
+  if (_listener != nullptr) _listener->onCommand(command, len);
+  return 0;
+}
+
+uint8_t RecordingInterface::sendData(uint8_t* data, uint16_t len) {
+  _record(EventType::Data, data, len);
+  if (_listener != nullptr) _listener->onData(data, len);
+  return 0;
+}
+
+void RecordingInterface::beginBurst() {
+  _record(EventType::BeginBurst, nullptr, 0);
+}
+
+uint8_t RecordingInterface::endBurst() {
+  _record(EventType::EndBurst, nullptr, 0);
+  return 0;
+}
+
+const std::vector<RecordingInterface::Event>& RecordingInterface::getEvents() {
+  return _events;
+}
+
+void RecordingInterface::clearEvents() {
+  _events.clear();
+}
+
+void RecordingInterface::setListener(Listener* listener) {
+  _listener = listener;
+}
+
+void RecordingInterface::_record(
+  EventType eventType, const uint8_t* bytes, uint16_t len
+) {
+  Event event;
+  event.type = eventType;
+  event.bytes.assign(bytes, bytes + len);
+  _events.push_back(event);
+}
+
+BusStats RecordingInterface::getStats(BusModel model) {
+  BusStats stats;
+  uint64_t bits = 0;
+  uint64_t overheadNs = 0;
+  // Payload per transaction, I2C needs room for the control byte.
+  uint32_t chunk = model.bufferSize > 1 ? model.bufferSize - 1 : 0;
+  bool burst = false;
+  bool burstStarted = false;
+  for (const Event& event : _events) {
+    uint32_t len = event.bytes.size();
+    if (event.type == EventType::BeginBurst) {
+      burst = true;
+      burstStarted = false;
+      continue;
+    } else if (event.type == EventType::EndBurst) {
+      burst = false;
+      continue;
+    } else if (event.type == EventType::Command) {
+      stats.commandCalls++;
+      stats.commandBytes += len;
+    } else if (event.type == EventType::Data) {
+      stats.dataCalls++;
+      stats.dataBytes += len;
+    } else {
+      continue;
+    }
+    if (len == 0) continue;
+    uint32_t transactions = 1;
+    if (chunk > 0) transactions = (len + chunk - 1) / chunk;
+    if (model.type == InterfaceType::Spi && burst) {
+      // CS# stays low for the whole burst.
+      transactions = burstStarted ? 0 : 1;
+      burstStarted = true;
+    }
+    stats.transactions += transactions;
+    if (model.type == InterfaceType::I2c) {
+      // Address and control byte for every transaction.
+      uint32_t wire = len + 2 * transactions;
+      stats.wireBytes += wire;
+      bits += (uint64_t)wire * I2C_BITS_PER_BYTE;
+      bits += (uint64_t)transactions * I2C_START_STOP_BITS;
+    } else {
+      stats.wireBytes += len;
+      bits += (uint64_t)len * 8;
+      overheadNs += (uint64_t)transactions * SPI_TRANSACTION_OVERHEAD_NS;
+    }
+  }
+  stats.micros = bits * 1000000 / model.frequency + overheadNs / 1000;
+  return stats;
+}
+
+MockImplementation::MockImplementation(
+  uint8_t width, uint8_t height, RecordingInterface* recorder
+): Implementation(width, height)
+{
+  interface = recorder;
+}
+
+void MockImplementation::_waitms(uint16_t ms) {
+  _waited += ms;
+}
+
+uint32_t MockImplementation::getWaited() {
+  return _waited;
+}
+
+void MockImplementation::clearWaited() {
+  _waited = 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Host side (Linux, macOS) recording interface for the SSD1327 Grayscale
+ * driver library. Records all traffic instead of sending it to a display, so
+ * the library can be run and measured without hardware.
+ *
+ */
+#ifndef SSD1327_MOCK_H
+#define SSD1327_MOCK_H
+
+#include <stdint.h>
+#include <vector>
+#include "ssd1327.h"
+
+namespace Ssd1327 {
+
+/**
+ * Model of the physical bus, used to turn the recorded calls into bytes on the
+ * wire, transactions and transfer time.
+ */
+struct BusModel {
+  Interface::InterfaceType type;
+  // Bus clock in Hz.
+  uint32_t frequency;
+  // Largest payload of one transaction (I2C: Wire buffer including the
+  // control byte), 0 for unlimited.
+  uint16_t bufferSize;
+
+  static BusModel i2c(uint32_t frequency, uint16_t bufferSize);
+  static BusModel spi(uint32_t frequency);
+};
+
+/**
+ * Totals of the recorded traffic.
+ */
+struct BusStats {
+  uint32_t commandCalls = 0;
+  uint32_t dataCalls = 0;
+  uint32_t commandBytes = 0;
+  uint32_t dataBytes = 0;
+  // Bytes on the wire including I2C address and control bytes.
+  uint32_t wireBytes = 0;
+  // I2C START/STOP pairs or SPI CS# cycles. SPI data and commands sent during
+  // a burst share one CS# cycle.
+  uint32_t transactions = 0;
+  // Modeled transfer time in microseconds.
+  uint32_t micros = 0;
+};
+
+class RecordingInterface: public Interface {
+  public:
+    enum class EventType: uint8_t {
+      BeginTransmission = 0,
+      EndTransmission   = 1,
+      Write             = 2,
+      Command           = 3,
+      Data              = 4,
+      BeginBurst        = 5,
+      EndBurst          = 6
+    };
+    struct Event {
+      EventType type;
+      std::vector<uint8_t> bytes;
+    };
+
+    /**
+     * Optional receiver of everything written to the display, e.g. an
+     * emulator. Called for every command and data call.
+     */
+    class Listener {
+      public:
+        virtual void onCommand(const uint8_t* command, uint16_t len)=0;
+        virtual void onData(const uint8_t* data, uint16_t len)=0;
+    };
+
+    RecordingInterface(InterfaceType interfaceType);
+    void beginTransmission();
+    uint8_t endTransmission();
+    void write(uint8_t byte);
+    uint8_t sendCommand(uint8_t command);
+    uint8_t sendCommand(uint8_t* command, uint8_t len);
+    uint8_t sendData(uint8_t* data, uint16_t len);
+    void beginBurst();
+    uint8_t endBurst();
+
+    const std::vector<Event>& getEvents();
+    void clearEvents();
+    void setListener(Listener* listener);
+    /**
+     * Calculate the bus statistics of all recorded events.
+     * @param model of the bus the events would be sent over.
+     */
+    BusStats getStats(BusModel model);
+
+  private:
+    std::vector<Event> _events;
+    Listener* _listener = nullptr;
+
+    void _record(EventType type, const uint8_t* bytes, uint16_t len);
+};
+
+/**
+ * Implementation for the host, waits are not executed but accumulated.
+ */
+class MockImplementation: public Implementation {
+  private:
+    uint32_t _waited = 0;
+    void _waitms(uint16_t ms);
+  public:
+    MockImplementation(
+      uint8_t width, uint8_t height, RecordingInterface* recorder
+    );
+    // Total of all requested waits in ms.
+    uint32_t getWaited();
+    void clearWaited();
+};
+};
+#endif
@@ -0,0 +1,122 @@
+#include "ssd1327ThreadDma.h"
+#include <chrono>
+
+using namespace Ssd1327;
+
+ThreadDmaInterface::ThreadDmaInterface(
+  Interface* target, uint32_t bytesPerSecond
+): _target(target), _bytesPerSecond(bytesPerSecond) {
+  type = target->type;
+  _worker = std::thread(&ThreadDmaInterface::_run, this);
+}
+
+ThreadDmaInterface::~ThreadDmaInterface() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _changed.notify_all();
+  _worker.join();
+}
+
+void ThreadDmaInterface::begin() {
+  _target->begin();
+}
+
+bool ThreadDmaInterface::hwReset() {
+  wait();
+  return _target->hwReset();
+}
+
+void ThreadDmaInterface::beginTransmission() {
+  wait();
+  _target->beginTransmission();
+}
+
+uint8_t ThreadDmaInterface::endTransmission() {
+  return _target->endTransmission();
+}
+
+void ThreadDmaInterface::write(uint8_t byte) {
+  _target->write(byte);
+}
+
+uint8_t ThreadDmaInterface::sendCommand(uint8_t command) {
+  return sendCommand(&command, 1);
+}
+
+uint8_t ThreadDmaInterface::sendCommand(uint8_t* command, uint8_t len) {
+  wait();
+  return _target->sendCommand(command, len);
+}
+
+uint8_t ThreadDmaInterface::sendData(uint8_t* data, uint16_t len) {
+  wait();
+  _transfer(len);
+  return _target->sendData(data, len);
+}
+
+void ThreadDmaInterface::beginBurst() {
+  wait();
+  _target->beginBurst();
+}
+
+uint8_t ThreadDmaInterface::endBurst() {
+  wait();
+  return _target->endBurst();
+}
+
+uint8_t ThreadDmaInterface::sendDataAsync(uint8_t* data, uint16_t len) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _changed.wait(lock, [this] { return !_busy; });
+  _data = data;
+  _len = len;
+  _pending = true;
+  _busy = true;
+  _changed.notify_all();
+  return 0;
+}
+
+bool ThreadDmaInterface::isBusy() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _busy;
+}
+
+uint8_t ThreadDmaInterface::wait() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _changed.wait(lock, [this] { return !_busy; });
+  return _status;
+}
+
+/**
+ * The transfer is done before the callback runs, so the callback can start
+ * the next transfer or send commands.
+ */
+void ThreadDmaInterface::_run() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _changed.wait(lock, [this] { return _stop || _pending; });
+    if (_stop) return;
+    _pending = false;
+    uint8_t* data = _data;
+    uint16_t len = _len;
+    lock.unlock();
+    _transfer(len);
+    uint8_t status = _target->sendData(data, len);
+    lock.lock();
+    _busy = false;
+    _status = status;
+    _changed.notify_all();
+    lock.unlock();
+    _complete(status);
+    lock.lock();
+  }
+}
+
+// Take as long as the modeled bus would.
+void ThreadDmaInterface::_transfer(uint16_t len) {
+  if (_bytesPerSecond == 0) return;
+  std::this_thread::sleep_for(
+    std::chrono::microseconds((uint64_t)len * 1000000 / _bytesPerSecond)
+  );
+}
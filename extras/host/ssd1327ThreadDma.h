@@ -0,0 +1,69 @@
+/*
+ * Host side (Linux, macOS) DMA emulation for the SSD1327 Grayscale driver
+ * library. Sends data on a worker thread, so asynchronous flushing can be run
+ * and tested without hardware.
+ *
+ */
+#ifndef SSD1327_THREAD_DMA_H
+#define SSD1327_THREAD_DMA_H
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "ssd1327.h"
+
+namespace Ssd1327 {
+
+/**
+ * DmaInterface that passes everything on to another interface, e.g. a
+ * RecordingInterface, with asynchronous transfers sent from a worker thread.
+ * The completion callback runs on the worker thread, like it would run in an
+ * interrupt handler on an MCU.
+ */
+class ThreadDmaInterface: public DmaInterface {
+  public:
+    /**
+     * @param target interface the data is sent to.
+     * @param bytesPerSecond modeled speed of the bus, transfers take that
+     *        long on the worker thread. 0 sends as fast as possible.
+     */
+    ThreadDmaInterface(Interface* target, uint32_t bytesPerSecond = 0);
+    ~ThreadDmaInterface();
+
+    void begin();
+    bool hwReset();
+    void beginTransmission();
+    uint8_t endTransmission();
+    void write(uint8_t byte);
+    uint8_t sendCommand(uint8_t command);
+    uint8_t sendCommand(uint8_t* command, uint8_t len);
+    uint8_t sendData(uint8_t* data, uint16_t len);
+    void beginBurst();
+    uint8_t endBurst();
+    uint8_t sendDataAsync(uint8_t* data, uint16_t len);
+    bool isBusy();
+    /**
+     * Wait for the running transfer to complete.
+     * @return Status of the last transfer.
+     */
+    uint8_t wait();
+
+  private:
+    Interface* _target;
+    uint32_t _bytesPerSecond;
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    uint8_t* _data = nullptr;
+    uint16_t _len = 0;
+    bool _pending = false;
+    bool _busy = false;
+    bool _stop = false;
+    uint8_t _status = 0;
+    std::thread _worker;
+
+    void _run();
+    void _transfer(uint16_t len);
+};
+};
+#endif
@@ -0,0 +1,376 @@
+// Generated by convertfont from DejaVuSans.ttf, 12px.
+#ifndef FONT_DEJAVUSANS12_H
+#define FONT_DEJAVUSANS12_H
+#include "ssd1327Font.h"
+
+static const unsigned char dejaVuSans12_atlas[] = {
+  0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 
+  0x02, 0xf0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 
+  0x03, 0xf0, 0x00, 0x0d, 0x29, 0x50, 0x0d, 0x29, 0x50, 0x0d, 0x29, 0x50, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x3b, 0x00, 0x00, 
+  0x02, 0xc0, 0x77, 0x00, 0x06, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x0a, 0x50, 
+  0xe0, 0x00, 0x00, 0x0d, 0x13, 0xb0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x70, 
+  0x00, 0x68, 0x0b, 0x30, 0x00, 0x00, 0xa4, 0x1d, 0x00, 0x00, 0x00, 0x08, 
+  0x10, 0x00, 0x03, 0xcf, 0xd6, 0x00, 0x0d, 0x78, 0x39, 0x20, 0x0e, 0x28, 
+  0x10, 0x00, 0x07, 0xcb, 0x40, 0x00, 0x00, 0x2a, 0xad, 0x20, 0x00, 0x08, 
+  0x18, 0x90, 0x0a, 0x38, 0x3b, 0x70, 0x04, 0xcf, 0xe9, 0x00, 0x00, 0x08, 
+  0x10, 0x00, 0x00, 0x08, 0x10, 0x00, 0x08, 0xeb, 0x10, 0x05, 0x90, 0x00, 
+  0x2d, 0x18, 0x80, 0x1c, 0x10, 0x00, 0x59, 0x04, 0xa0, 0x86, 0x00, 0x00, 
+  0x3d, 0x18, 0x83, 0xb0, 0x00, 0x00, 0x08, 0xec, 0x1b, 0x37, 0xec, 0x10, 
+  0x00, 0x00, 0x68, 0x2d, 0x18, 0x80, 0x00, 0x01, 0xc1, 0x4a, 0x04, 0xb0, 
+  0x00, 0x09, 0x50, 0x2d, 0x18, 0x80, 0x00, 0x3b, 0x00, 0x07, 0xec, 0x20, 
+  0x00, 0x6e, 0xe7, 0x00, 0x00, 0x02, 0xf3, 0x19, 0x10, 0x00, 0x02, 0xe1, 
+  0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x0a, 0x79, 0xb0, 0x09, 
+  0x70, 0x2f, 0x00, 0x9b, 0x1d, 0x30, 0x3f, 0x10, 0x0a, 0xda, 0x00, 0x0d, 
+  0xa2, 0x17, 0xfb, 0x00, 0x02, 0xae, 0xea, 0x3c, 0x80, 0x0d, 0x20, 0x0d, 
+  0x20, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x01, 0xe1, 0x00, 0x06, 0xa0, 0x00, 
+  0x0b, 0x60, 0x00, 0x0d, 0x40, 0x00, 0x0e, 0x30, 0x00, 0x0d, 0x40, 0x00, 
+  0x0b, 0x60, 0x00, 0x06, 0xa0, 0x00, 0x01, 0xd1, 0x00, 0x00, 0x77, 0x00, 
+  0x0c, 0x30, 0x00, 0x05, 0xa0, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xb6, 0x00, 
+  0x00, 0x89, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x89, 0x00, 0x00, 0xb6, 0x00, 
+  0x00, 0xe2, 0x00, 0x05, 0xa0, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x55, 0x00, 
+  0x67, 0x55, 0x76, 0x06, 0xcc, 0x60, 0x06, 0xcc, 0x60, 0x67, 0x55, 0x76, 
+  0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 
+  0x78, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x78, 0x00, 
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x09, 
+  0xa0, 0x0b, 0x60, 0x0d, 0x00, 0x6f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0b, 0x80, 0x0b, 0x80, 0x00, 0x2d, 0x00, 0x00, 0x69, 0x00, 0x00, 
+  0xb4, 0x00, 0x01, 0xe0, 0x00, 0x05, 0xa0, 0x00, 0x0a, 0x60, 0x00, 0x0e, 
+  0x10, 0x00, 0x4b, 0x00, 0x00, 0x87, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x01, 
+  0xae, 0xd6, 0x00, 0x09, 0xb1, 0x4e, 0x40, 0x0e, 0x40, 0x09, 0x90, 0x2f, 
+  0x10, 0x06, 0xc0, 0x3f, 0x00, 0x05, 0xc0, 0x2f, 0x10, 0x06, 0xc0, 0x0e, 
+  0x40, 0x09, 0x90, 0x09, 0xb1, 0x4e, 0x40, 0x01, 0xae, 0xe6, 0x00, 0x0a, 
+  0xff, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 
+  0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 
+  0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x08, 0xff, 0xff, 0x80, 0x05, 
+  0xce, 0xc5, 0x00, 0x1a, 0x31, 0x6f, 0x20, 0x00, 0x00, 0x0d, 0x50, 0x00, 
+  0x00, 0x1f, 0x30, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x0a, 0xb0, 0x00, 0x00, 
+  0xab, 0x00, 0x00, 0x0a, 0xb1, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x70, 0x03, 
+  0xbe, 0xd6, 0x00, 0x09, 0x41, 0x4e, 0x40, 0x00, 0x00, 0x0b, 0x60, 0x00, 
+  0x00, 0x4e, 0x30, 0x00, 0x9f, 0xf7, 0x00, 0x00, 0x00, 0x3d, 0x60, 0x00, 
+  0x00, 0x08, 0x90, 0x19, 0x20, 0x3d, 0x60, 0x05, 0xce, 0xd7, 0x00, 0x00, 
+  0x02, 0xeb, 0x00, 0x00, 0x0b, 0xbb, 0x00, 0x00, 0x5a, 0x7b, 0x00, 0x01, 
+  0xd2, 0x7b, 0x00, 0x09, 0x70, 0x7b, 0x00, 0x3c, 0x00, 0x7b, 0x00, 0x6f, 
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x0b, 
+  0xff, 0xfe, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x0b, 
+  0xee, 0xc5, 0x00, 0x00, 0x01, 0x6f, 0x30, 0x00, 0x00, 0x0a, 0x80, 0x00, 
+  0x00, 0x0a, 0x80, 0x19, 0x21, 0x6f, 0x30, 0x06, 0xde, 0xc5, 0x00, 0x00, 
+  0x6d, 0xe9, 0x10, 0x04, 0xd4, 0x16, 0x40, 0x0c, 0x60, 0x00, 0x00, 0x0f, 
+  0x7e, 0xe9, 0x00, 0x2f, 0xb2, 0x2c, 0x80, 0x1f, 0x50, 0x06, 0xc0, 0x0e, 
+  0x50, 0x06, 0xc0, 0x08, 0xc2, 0x2c, 0x70, 0x00, 0x9e, 0xe8, 0x00, 0x0f, 
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x1e, 0x40, 0x00, 0x00, 0x6d, 0x00, 0x00, 
+  0x00, 0xb7, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x07, 0xb0, 0x00, 0x00, 
+  0x0d, 0x60, 0x00, 0x00, 0x4e, 0x10, 0x00, 0x00, 0x99, 0x00, 0x00, 0x02, 
+  0xbe, 0xe8, 0x00, 0x0c, 0x91, 0x2d, 0x60, 0x0e, 0x40, 0x09, 0x80, 0x0a, 
+  0x91, 0x2d, 0x40, 0x02, 0xdf, 0xf9, 0x00, 0x0d, 0x71, 0x2c, 0x70, 0x2f, 
+  0x10, 0x06, 0xc0, 0x0e, 0x71, 0x2c, 0x90, 0x04, 0xce, 0xe9, 0x10, 0x02, 
+  0xbe, 0xd5, 0x00, 0x0d, 0x81, 0x4e, 0x30, 0x3f, 0x10, 0x0a, 0x80, 0x3f, 
+  0x10, 0x0a, 0xb0, 0x0d, 0x81, 0x4e, 0xc0, 0x03, 0xce, 0xc9, 0xa0, 0x00, 
+  0x00, 0x0b, 0x70, 0x07, 0x31, 0x7e, 0x10, 0x03, 0xce, 0xb2, 0x00, 0x09, 
+  0xa0, 0x09, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa0, 0x09, 0xa0, 0x09, 
+  0xa0, 0x09, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa0, 0x0b, 0x60, 0x0d, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xa0, 0x00, 0x03, 0x8d, 0xb6, 0x20, 0x06, 
+  0xdb, 0x61, 0x00, 0x00, 0x06, 0xdb, 0x61, 0x00, 0x00, 0x00, 0x03, 0x8d, 
+  0xb6, 0x10, 0x00, 0x00, 0x00, 0x39, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0b, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 
+  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0a, 0x94, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xd8, 0x30, 0x00, 0x00, 
+  0x00, 0x16, 0xbd, 0x70, 0x00, 0x00, 0x16, 0xbd, 0x70, 0x01, 0x6b, 0xd9, 
+  0x30, 0x00, 0x0a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x06, 0xde, 0xa0, 0x29, 0x12, 0xd6, 0x00, 0x00, 0xc6, 0x00, 0x09, 0xb0, 
+  0x00, 0x7b, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 
+  0x00, 0xb7, 0x00, 0x00, 0x04, 0xbe, 0xec, 0x60, 0x00, 0x00, 0x8c, 0x52, 
+  0x13, 0xab, 0x10, 0x05, 0xb1, 0x00, 0x00, 0x08, 0x80, 0x0c, 0x20, 0x8e, 
+  0xd8, 0x80, 0xd0, 0x1b, 0x04, 0xc2, 0x2c, 0x80, 0xb2, 0x3a, 0x06, 0x80, 
+  0x07, 0x80, 0xc0, 0x2b, 0x04, 0xc2, 0x1c, 0x87, 0x90, 0x0c, 0x20, 0x8e, 
+  0xc8, 0xd8, 0x00, 0x06, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x41, 
+  0x14, 0xb3, 0x00, 0x00, 0x05, 0xbe, 0xec, 0x71, 0x00, 0x00, 0x0b, 0xe0, 
+  0x00, 0x00, 0x00, 0x2f, 0xd5, 0x00, 0x00, 0x00, 0x7a, 0x7b, 0x00, 0x00, 
+  0x00, 0xd5, 0x2f, 0x10, 0x00, 0x04, 0xe1, 0x0c, 0x70, 0x00, 0x09, 0xa0, 
+  0x07, 0xc0, 0x00, 0x1e, 0xff, 0xff, 0xf3, 0x00, 0x5e, 0x00, 0x00, 0xb8, 
+  0x00, 0xb8, 0x00, 0x00, 0x5e, 0x00, 0x0c, 0xff, 0xeb, 0x30, 0x0c, 0x50, 
+  0x19, 0xc0, 0x0c, 0x50, 0x03, 0xf0, 0x0c, 0x50, 0x19, 0xb0, 0x0c, 0xff, 
+  0xfe, 0x30, 0x0c, 0x50, 0x05, 0xe2, 0x0c, 0x50, 0x00, 0xe5, 0x0c, 0x50, 
+  0x05, 0xf3, 0x0c, 0xff, 0xfd, 0x60, 0x00, 0x5c, 0xee, 0xa2, 0x06, 0xe6, 
+  0x11, 0x59, 0x1e, 0x60, 0x00, 0x00, 0x4f, 0x10, 0x00, 0x00, 0x5e, 0x00, 
+  0x00, 0x00, 0x4f, 0x10, 0x00, 0x00, 0x1e, 0x60, 0x00, 0x00, 0x06, 0xe6, 
+  0x11, 0x59, 0x00, 0x5c, 0xee, 0xa2, 0x0c, 0xff, 0xec, 0x60, 0x00, 0x0c, 
+  0x50, 0x15, 0xda, 0x00, 0x0c, 0x50, 0x00, 0x3f, 0x30, 0x0c, 0x50, 0x00, 
+  0x0d, 0x70, 0x0c, 0x50, 0x00, 0x0b, 0x80, 0x0c, 0x50, 0x00, 0x0d, 0x70, 
+  0x0c, 0x50, 0x00, 0x3f, 0x30, 0x0c, 0x50, 0x15, 0xda, 0x00, 0x0c, 0xff, 
+  0xec, 0x60, 0x00, 0x0c, 0xff, 0xff, 0xb0, 0x0c, 0x50, 0x00, 0x00, 0x0c, 
+  0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x80, 0x0c, 
+  0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 
+  0xff, 0xff, 0xc0, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0x50, 0x00, 0x00, 0x0c, 
+  0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0xff, 0xfc, 0x00, 0x0c, 
+  0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 
+  0x50, 0x00, 0x00, 0x00, 0x5c, 0xee, 0xb5, 0x00, 0x06, 0xe6, 0x21, 0x4a, 
+  0x10, 0x1e, 0x60, 0x00, 0x00, 0x00, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x5e, 
+  0x00, 0x0c, 0xff, 0x50, 0x4f, 0x10, 0x00, 0x0d, 0x50, 0x1e, 0x60, 0x00, 
+  0x0d, 0x50, 0x06, 0xe6, 0x11, 0x3e, 0x50, 0x00, 0x5c, 0xee, 0xc6, 0x00, 
+  0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 0x50, 
+  0x00, 0x5d, 0x00, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 0xff, 0xff, 0xfd, 
+  0x00, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 
+  0x50, 0x00, 0x5d, 0x00, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x0c, 0x50, 0x0c, 
+  0x50, 0x0c, 0x50, 0x0c, 0x50, 0x0c, 0x50, 0x0c, 0x50, 0x0c, 0x50, 0x0c, 
+  0x50, 0x0c, 0x50, 0x00, 0xc5, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xc5, 0x00, 
+  0x00, 0xc5, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xc5, 0x00, 
+  0x00, 0xc5, 0x00, 0x00, 0xd5, 0x00, 0x04, 0xf2, 0x00, 0x9d, 0x70, 0x00, 
+  0x0c, 0x50, 0x04, 0xe5, 0x00, 0x0c, 0x50, 0x4e, 0x40, 0x00, 0x0c, 0x55, 
+  0xe4, 0x00, 0x00, 0x0c, 0xae, 0x40, 0x00, 0x00, 0x0c, 0xec, 0x00, 0x00, 
+  0x00, 0x0c, 0x6c, 0xb0, 0x00, 0x00, 0x0c, 0x51, 0xca, 0x00, 0x00, 0x0c, 
+  0x50, 0x1c, 0xa0, 0x00, 0x0c, 0x50, 0x01, 0xd9, 0x00, 0x0c, 0x50, 0x00, 
+  0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 
+  0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 
+  0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x90, 0x0c, 0xf2, 0x00, 
+  0x0c, 0xf3, 0x0c, 0xd8, 0x00, 0x2d, 0xf3, 0x0c, 0x7d, 0x00, 0x87, 0xf3, 
+  0x0c, 0x5b, 0x40, 0xd2, 0xf3, 0x0c, 0x56, 0xa4, 0xb0, 0xf3, 0x0c, 0x51, 
+  0xeb, 0x50, 0xf3, 0x0c, 0x50, 0x9e, 0x00, 0xf3, 0x0c, 0x50, 0x00, 0x00, 
+  0xf3, 0x0c, 0x50, 0x00, 0x00, 0xf3, 0x0c, 0xe1, 0x00, 0x5c, 0x00, 0x0c, 
+  0xe8, 0x00, 0x5c, 0x00, 0x0c, 0x7e, 0x10, 0x5c, 0x00, 0x0c, 0x59, 0x90, 
+  0x5c, 0x00, 0x0c, 0x52, 0xe2, 0x5c, 0x00, 0x0c, 0x50, 0x99, 0x5c, 0x00, 
+  0x0c, 0x50, 0x2e, 0x7c, 0x00, 0x0c, 0x50, 0x09, 0xec, 0x00, 0x0c, 0x50, 
+  0x01, 0xec, 0x00, 0x00, 0x5c, 0xfe, 0x91, 0x00, 0x06, 0xe5, 0x12, 0xbc, 
+  0x00, 0x1e, 0x60, 0x00, 0x1e, 0x60, 0x4f, 0x10, 0x00, 0x09, 0xa0, 0x5e, 
+  0x00, 0x00, 0x08, 0xb0, 0x4f, 0x10, 0x00, 0x09, 0xa0, 0x1e, 0x60, 0x00, 
+  0x1e, 0x60, 0x06, 0xe5, 0x12, 0xbc, 0x00, 0x00, 0x6c, 0xfe, 0x91, 0x00, 
+  0x0c, 0xff, 0xea, 0x10, 0x0c, 0x50, 0x2c, 0x90, 0x0c, 0x50, 0x07, 0xc0, 
+  0x0c, 0x50, 0x2c, 0x90, 0x0c, 0xff, 0xea, 0x10, 0x0c, 0x50, 0x00, 0x00, 
+  0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 
+  0x00, 0x5c, 0xfe, 0x91, 0x00, 0x06, 0xe5, 0x12, 0xbc, 0x00, 0x1e, 0x60, 
+  0x00, 0x1e, 0x60, 0x4f, 0x10, 0x00, 0x09, 0xa0, 0x5e, 0x00, 0x00, 0x08, 
+  0xb0, 0x4f, 0x10, 0x00, 0x09, 0xa0, 0x1e, 0x60, 0x00, 0x1e, 0x60, 0x06, 
+  0xe5, 0x12, 0xbc, 0x00, 0x00, 0x5c, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x07, 
+  0xd1, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x0c, 0xff, 0xea, 0x10, 0x0c, 
+  0x50, 0x2c, 0x90, 0x0c, 0x50, 0x07, 0xc0, 0x0c, 0x50, 0x2c, 0x90, 0x0c, 
+  0xff, 0xfb, 0x10, 0x0c, 0x50, 0x3e, 0x40, 0x0c, 0x50, 0x07, 0xc0, 0x0c, 
+  0x50, 0x01, 0xe5, 0x0c, 0x50, 0x00, 0x8c, 0x03, 0xbe, 0xd8, 0x10, 0x0e, 
+  0x71, 0x27, 0x60, 0x2f, 0x00, 0x00, 0x00, 0x1e, 0x82, 0x00, 0x00, 0x02, 
+  0xae, 0xe9, 0x10, 0x00, 0x00, 0x2b, 0xa0, 0x00, 0x00, 0x05, 0xe0, 0x2a, 
+  0x31, 0x2b, 0xb0, 0x05, 0xce, 0xea, 0x10, 0x0f, 0xff, 0xff, 0xff, 0x50, 
+  0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 
+  0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 
+  0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 
+  0x00, 0xe4, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x7b, 0x00, 0x0e, 0x40, 0x00, 
+  0x7b, 0x00, 0x0e, 0x40, 0x00, 0x7b, 0x00, 0x0e, 0x40, 0x00, 0x7b, 0x00, 
+  0x0e, 0x40, 0x00, 0x7b, 0x00, 0x0e, 0x40, 0x00, 0x7b, 0x00, 0x0c, 0x60, 
+  0x00, 0x99, 0x00, 0x07, 0xd3, 0x14, 0xe4, 0x00, 0x00, 0x7d, 0xec, 0x50, 
+  0x00, 0xb8, 0x00, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x00, 0xa8, 0x00, 0x1e, 
+  0x40, 0x01, 0xf3, 0x00, 0x09, 0x90, 0x06, 0xc0, 0x00, 0x04, 0xe1, 0x0c, 
+  0x70, 0x00, 0x00, 0xd5, 0x2f, 0x10, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0x00, 
+  0x00, 0x2f, 0xd5, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x7b, 0x00, 
+  0x0d, 0xb0, 0x00, 0xd5, 0x3e, 0x00, 0x1d, 0xe0, 0x01, 0xf2, 0x0e, 0x30, 
+  0x59, 0xb3, 0x05, 0xd0, 0x0b, 0x70, 0x96, 0x87, 0x09, 0x90, 0x08, 0xa0, 
+  0xc2, 0x4a, 0x0c, 0x60, 0x04, 0xe1, 0xe0, 0x1e, 0x1f, 0x20, 0x01, 0xf7, 
+  0xa0, 0x0c, 0x7d, 0x00, 0x00, 0xce, 0x60, 0x09, 0xea, 0x00, 0x00, 0x8f, 
+  0x30, 0x05, 0xf6, 0x00, 0x1d, 0x50, 0x01, 0xd5, 0x04, 0xe1, 0x09, 0xa0, 
+  0x00, 0xaa, 0x4e, 0x10, 0x00, 0x1e, 0xe5, 0x00, 0x00, 0x0a, 0xe1, 0x00, 
+  0x00, 0x5e, 0xb9, 0x00, 0x01, 0xe5, 0x1e, 0x40, 0x0a, 0xa0, 0x06, 0xd0, 
+  0x5e, 0x10, 0x00, 0xb8, 0x0b, 0x90, 0x00, 0x4e, 0x10, 0x02, 0xe4, 0x01, 
+  0xd6, 0x00, 0x00, 0x6d, 0x08, 0xb0, 0x00, 0x00, 0x0b, 0xae, 0x20, 0x00, 
+  0x00, 0x02, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 
+  0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x00, 
+  0x00, 0x5f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x05, 0xe2, 0x00, 0x00, 0x2e, 
+  0x50, 0x00, 0x01, 0xd8, 0x00, 0x00, 0x0a, 0xb0, 0x00, 0x00, 0x7d, 0x10, 
+  0x00, 0x04, 0xe3, 0x00, 0x00, 0x2e, 0x60, 0x00, 0x00, 0x7f, 0xff, 0xff, 
+  0xfa, 0x0f, 0xf8, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 
+  0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 
+  0x00, 0x0f, 0x20, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0xf8, 0x00, 0xd2, 0x00, 
+  0x00, 0x87, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x0a, 0x60, 
+  0x00, 0x05, 0xa0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x69, 
+  0x00, 0x00, 0x2d, 0x00, 0x0c, 0xfa, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 
+  0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 
+  0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x0c, 0xfa, 
+  0x00, 0x00, 0x03, 0xde, 0x30, 0x00, 0x00, 0x3d, 0x54, 0xd4, 0x00, 0x04, 
+  0xc3, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf2, 0x08, 0x80, 
+  0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc3, 0x00, 0x00, 0x01, 0x6d, 0x00, 
+  0x00, 0x00, 0x0d, 0x20, 0x06, 0xdf, 0xff, 0x40, 0x2e, 0x30, 0x0d, 0x40, 
+  0x3e, 0x21, 0x7f, 0x40, 0x08, 0xee, 0x9c, 0x40, 0x0e, 0x30, 0x00, 0x00, 
+  0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x7d, 0xe9, 0x00, 
+  0x0e, 0xc2, 0x2c, 0x70, 0x0e, 0x50, 0x05, 0xd0, 0x0e, 0x30, 0x03, 0xe0, 
+  0x0e, 0x50, 0x05, 0xd0, 0x0e, 0xc2, 0x2c, 0x70, 0x0e, 0x7d, 0xe9, 0x00, 
+  0x02, 0xae, 0xd4, 0x00, 0x0c, 0x91, 0x28, 0x00, 0x3e, 0x00, 0x00, 0x00, 
+  0x5c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0c, 0x91, 0x28, 0x00, 
+  0x02, 0xae, 0xd4, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 
+  0x00, 0x00, 0x08, 0x80, 0x02, 0xce, 0xba, 0x80, 0x0d, 0x81, 0x5f, 0x80, 
+  0x3e, 0x00, 0x0b, 0x80, 0x5c, 0x00, 0x09, 0x80, 0x3e, 0x00, 0x0b, 0x80, 
+  0x0d, 0x81, 0x5f, 0x80, 0x03, 0xce, 0xba, 0x80, 0x01, 0xae, 0xd7, 0x00, 
+  0x0c, 0x91, 0x2d, 0x40, 0x3e, 0x00, 0x06, 0x90, 0x5f, 0xff, 0xff, 0xb0, 
+  0x3d, 0x00, 0x00, 0x00, 0x0c, 0x81, 0x16, 0x60, 0x01, 0xae, 0xe9, 0x10, 
+  0x02, 0xcf, 0x70, 0x08, 0x90, 0x00, 0x0a, 0x60, 0x00, 0xbf, 0xff, 0x30, 
+  0x0a, 0x60, 0x00, 0x0a, 0x60, 0x00, 0x0a, 0x60, 0x00, 0x0a, 0x60, 0x00, 
+  0x0a, 0x60, 0x00, 0x0a, 0x60, 0x00, 0x03, 0xce, 0xba, 0x80, 0x0d, 0x71, 
+  0x5f, 0x80, 0x3e, 0x00, 0x0a, 0x80, 0x5c, 0x00, 0x09, 0x80, 0x3e, 0x00, 
+  0x0a, 0x80, 0x0d, 0x71, 0x5f, 0x80, 0x03, 0xce, 0xba, 0x80, 0x00, 0x00, 
+  0x0b, 0x60, 0x06, 0x41, 0x6e, 0x20, 0x02, 0xbe, 0xc4, 0x00, 0x0e, 0x30, 
+  0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x7d, 
+  0xea, 0x00, 0x0e, 0xb2, 0x2d, 0x60, 0x0e, 0x40, 0x08, 0x80, 0x0e, 0x30, 
+  0x07, 0x90, 0x0e, 0x30, 0x07, 0x90, 0x0e, 0x30, 0x07, 0x90, 0x0e, 0x30, 
+  0x07, 0x90, 0x0d, 0x30, 0x00, 0x00, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 
+  0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x00, 0xd3, 0x00, 0x00, 
+  0x00, 0xd3, 0x00, 0xd3, 0x00, 0xd3, 0x00, 0xd3, 0x00, 0xd3, 0x00, 0xd3, 
+  0x00, 0xd3, 0x00, 0xd3, 0x02, 0xe1, 0x3e, 0x80, 0x0e, 0x30, 0x00, 0x00, 
+  0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x3d, 0x40, 
+  0x0e, 0x34, 0xd3, 0x00, 0x0e, 0x7d, 0x30, 0x00, 0x0e, 0xe9, 0x00, 0x00, 
+  0x0e, 0x4d, 0x70, 0x00, 0x0e, 0x31, 0xd7, 0x00, 0x0e, 0x30, 0x2d, 0x70, 
+  0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 
+  0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x0e, 0x8d, 0xe9, 0x3c, 
+  0xeb, 0x10, 0x0e, 0xb1, 0x2e, 0xd3, 0x1b, 0x70, 0x0e, 0x40, 0x0a, 0x70, 
+  0x07, 0xa0, 0x0e, 0x30, 0x0a, 0x60, 0x06, 0xa0, 0x0e, 0x30, 0x0a, 0x60, 
+  0x06, 0xa0, 0x0e, 0x30, 0x0a, 0x60, 0x06, 0xa0, 0x0e, 0x30, 0x0a, 0x60, 
+  0x06, 0xa0, 0x0e, 0x7d, 0xea, 0x00, 0x0e, 0xb2, 0x2d, 0x60, 0x0e, 0x40, 
+  0x08, 0x80, 0x0e, 0x30, 0x07, 0x90, 0x0e, 0x30, 0x07, 0x90, 0x0e, 0x30, 
+  0x07, 0x90, 0x0e, 0x30, 0x07, 0x90, 0x02, 0xbe, 0xd5, 0x00, 0x0d, 0x81, 
+  0x4e, 0x30, 0x3e, 0x00, 0x09, 0x80, 0x5c, 0x00, 0x07, 0xa0, 0x3e, 0x00, 
+  0x09, 0x80, 0x0d, 0x81, 0x4e, 0x30, 0x02, 0xbe, 0xd5, 0x00, 0x0e, 0x7d, 
+  0xe9, 0x00, 0x0e, 0xc2, 0x2c, 0x70, 0x0e, 0x50, 0x05, 0xd0, 0x0e, 0x30, 
+  0x03, 0xe0, 0x0e, 0x50, 0x05, 0xd0, 0x0e, 0xc2, 0x2c, 0x70, 0x0e, 0x7d, 
+  0xe9, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 
+  0x00, 0x00, 0x02, 0xce, 0xba, 0x80, 0x0d, 0x81, 0x5f, 0x80, 0x3e, 0x00, 
+  0x0b, 0x80, 0x5c, 0x00, 0x09, 0x80, 0x3e, 0x00, 0x0b, 0x80, 0x0d, 0x81, 
+  0x5f, 0x80, 0x03, 0xce, 0xba, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 
+  0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x0e, 0x7c, 0xe0, 0x0e, 0xc2, 0x00, 
+  0x0e, 0x40, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 
+  0x0e, 0x30, 0x00, 0x08, 0xee, 0x91, 0x3e, 0x21, 0x64, 0x3d, 0x10, 0x00, 
+  0x06, 0xbc, 0x71, 0x00, 0x01, 0xa8, 0x57, 0x21, 0xa9, 0x18, 0xde, 0xa1, 
+  0x0d, 0x30, 0x00, 0x0d, 0x30, 0x00, 0xaf, 0xff, 0x60, 0x0d, 0x30, 0x00, 
+  0x0d, 0x30, 0x00, 0x0d, 0x30, 0x00, 0x0d, 0x30, 0x00, 0x0c, 0x60, 0x00, 
+  0x05, 0xdf, 0x60, 0x0f, 0x10, 0x08, 0x80, 0x0f, 0x10, 0x08, 0x80, 0x0f, 
+  0x10, 0x08, 0x80, 0x0f, 0x10, 0x08, 0x80, 0x0e, 0x20, 0x0a, 0x80, 0x0c, 
+  0x81, 0x4e, 0x80, 0x03, 0xce, 0xaa, 0x80, 0x7a, 0x00, 0x09, 0x90, 0x2e, 
+  0x10, 0x0e, 0x30, 0x0c, 0x60, 0x4d, 0x00, 0x06, 0xb0, 0x98, 0x00, 0x01, 
+  0xf2, 0xe2, 0x00, 0x00, 0xbb, 0xc0, 0x00, 0x00, 0x5f, 0x70, 0x00, 0x6b, 
+  0x00, 0xda, 0x00, 0xd3, 0x2e, 0x01, 0xdd, 0x02, 0xe0, 0x0d, 0x35, 0x9c, 
+  0x26, 0xa0, 0x0a, 0x79, 0x58, 0x69, 0x70, 0x06, 0xac, 0x24, 0xad, 0x30, 
+  0x02, 0xed, 0x01, 0xee, 0x00, 0x00, 0xe9, 0x00, 0xcb, 0x00, 0x2e, 0x30, 
+  0x1e, 0x40, 0x06, 0xd1, 0xb8, 0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0x5f, 
+  0x60, 0x00, 0x01, 0xd9, 0xd1, 0x00, 0x09, 0xa0, 0x9a, 0x00, 0x5d, 0x10, 
+  0x1d, 0x50, 0x7a, 0x00, 0x09, 0x80, 0x1e, 0x10, 0x0e, 0x30, 0x0a, 0x70, 
+  0x5d, 0x00, 0x05, 0xc0, 0xb7, 0x00, 0x00, 0xe4, 0xf2, 0x00, 0x00, 0x8e, 
+  0xb0, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x3e, 0x10, 0x00, 0x00, 0x99, 
+  0x00, 0x00, 0x1f, 0xd2, 0x00, 0x00, 0x5f, 0xff, 0xfc, 0x00, 0x00, 0xc6, 
+  0x00, 0x0a, 0x90, 0x00, 0x7b, 0x00, 0x04, 0xd1, 0x00, 0x2e, 0x30, 0x00, 
+  0x7f, 0xff, 0xfc, 0x00, 0x03, 0xcf, 0x20, 0x00, 0x09, 0x90, 0x00, 0x00, 
+  0x0a, 0x60, 0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 0x2d, 0x40, 0x00, 0x08, 
+  0xfb, 0x00, 0x00, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 
+  0x0a, 0x60, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x03, 0xdf, 0x20, 0x07, 
+  0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 
+  0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 
+  0xea, 0x00, 0x00, 0x00, 0x1d, 0x30, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 
+  0x0b, 0x50, 0x00, 0x00, 0x0a, 0x90, 0x00, 0x00, 0x03, 0xef, 0x20, 0x00, 
+  0x0a, 0x91, 0x00, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 
+  0x1d, 0x30, 0x00, 0x07, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0xbe, 0xb5, 0x13, 0x90, 0x07, 0x31, 0x5b, 0xec, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 
+};
+// Offset, width, height, left, top, advance.
+static const Ssd1327::FontGlyph dejaVuSans12_glyphs[] = {
+  {0, 0, 0, 0, 0, 4}, // ' '
+  {0, 5, 9, 0, 3, 5}, // '!'
+  {27, 6, 9, 0, 3, 6}, // '"'
+  {54, 10, 8, 0, 4, 10}, // '#'
+  {94, 8, 11, 0, 3, 8}, // '$'
+  {138, 11, 9, 0, 3, 11}, // '%'
+  {192, 9, 9, 0, 3, 9}, // '&'
+  {237, 3, 9, 0, 3, 3}, // "'"
+  {255, 5, 11, 0, 2, 5}, // '('
+  {288, 5, 11, 0, 2, 5}, // ')'
+  {321, 6, 9, 0, 3, 6}, // '*'
+  {348, 10, 7, 0, 5, 10}, // '+'
+  {383, 4, 3, 0, 10, 4}, // ','
+  {389, 4, 4, 0, 8, 4}, // '-'
+  {397, 4, 2, 0, 10, 4}, // '.'
+  {401, 5, 10, 0, 3, 4}, // '/'
+  {431, 8, 9, 0, 3, 8}, // '0'
+  {467, 8, 9, 0, 3, 8}, // '1'
+  {503, 8, 9, 0, 3, 8}, // '2'
+  {539, 8, 9, 0, 3, 8}, // '3'
+  {575, 8, 9, 0, 3, 8}, // '4'
+  {611, 8, 9, 0, 3, 8}, // '5'
+  {647, 8, 9, 0, 3, 8}, // '6'
+  {683, 8, 9, 0, 3, 8}, // '7'
+  {719, 8, 9, 0, 3, 8}, // '8'
+  {755, 8, 9, 0, 3, 8}, // '9'
+  {791, 4, 6, 0, 6, 4}, // ':'
+  {803, 4, 7, 0, 6, 4}, // ';'
+  {817, 10, 7, 0, 5, 10}, // '<'
+  {852, 10, 5, 0, 7, 10}, // '='
+  {877, 10, 7, 0, 5, 10}, // '>'
+  {912, 6, 9, 0, 3, 6}, // '?'
+  {939, 12, 11, 0, 4, 12}, // '@'
+  {1005, 9, 9, 0, 3, 8}, // 'A'
+  {1050, 8, 9, 0, 3, 8}, // 'B'
+  {1086, 8, 9, 0, 3, 8}, // 'C'
+  {1122, 9, 9, 0, 3, 9}, // 'D'
+  {1167, 8, 9, 0, 3, 8}, // 'E'
+  {1203, 7, 9, 0, 3, 7}, // 'F'
+  {1239, 9, 9, 0, 3, 9}, // 'G'
+  {1284, 9, 9, 0, 3, 9}, // 'H'
+  {1329, 4, 9, 0, 3, 4}, // 'I'
+  {1347, 5, 11, -1, 3, 4}, // 'J'
+  {1380, 9, 9, 0, 3, 8}, // 'K'
+  {1425, 7, 9, 0, 3, 7}, // 'L'
+  {1461, 10, 9, 0, 3, 10}, // 'M'
+  {1506, 9, 9, 0, 3, 9}, // 'N'
+  {1551, 9, 9, 0, 3, 9}, // 'O'
+  {1596, 7, 9, 0, 3, 7}, // 'P'
+  {1632, 9, 11, 0, 3, 9}, // 'Q'
+  {1687, 8, 9, 0, 3, 8}, // 'R'
+  {1723, 8, 9, 0, 3, 8}, // 'S'
+  {1759, 9, 9, -1, 3, 7}, // 'T'
+  {1804, 9, 9, 0, 3, 9}, // 'U'
+  {1849, 9, 9, 0, 3, 8}, // 'V'
+  {1894, 12, 9, 0, 3, 12}, // 'W'
+  {1948, 8, 9, 0, 3, 8}, // 'X'
+  {1984, 9, 9, -1, 3, 7}, // 'Y'
+  {2029, 8, 9, 0, 3, 8}, // 'Z'
+  {2065, 5, 11, 0, 3, 5}, // '['
+  {2098, 5, 10, 0, 3, 4}, // '\\'
+  {2128, 5, 11, 0, 3, 5}, // ']'
+  {2161, 10, 9, 0, 3, 10}, // '^'
+  {2206, 8, 3, -1, 12, 6}, // '_'
+  {2218, 6, 10, 0, 2, 6}, // '`'
+  {2248, 7, 7, 0, 5, 7}, // 'a'
+  {2276, 8, 10, 0, 2, 8}, // 'b'
+  {2316, 7, 7, 0, 5, 7}, // 'c'
+  {2344, 8, 10, 0, 2, 8}, // 'd'
+  {2384, 7, 7, 0, 5, 7}, // 'e'
+  {2412, 5, 10, 0, 2, 4}, // 'f'
+  {2442, 8, 10, 0, 5, 8}, // 'g'
+  {2482, 8, 10, 0, 2, 8}, // 'h'
+  {2522, 3, 9, 0, 3, 3}, // 'i'
+  {2540, 4, 12, -1, 3, 3}, // 'j'
+  {2564, 7, 10, 0, 2, 7}, // 'k'
+  {2604, 3, 10, 0, 2, 3}, // 'l'
+  {2624, 12, 7, 0, 5, 12}, // 'm'
+  {2666, 8, 7, 0, 5, 8}, // 'n'
+  {2694, 7, 7, 0, 5, 7}, // 'o'
+  {2722, 8, 10, 0, 5, 8}, // 'p'
+  {2762, 8, 10, 0, 5, 8}, // 'q'
+  {2802, 5, 7, 0, 5, 5}, // 'r'
+  {2823, 6, 7, 0, 5, 6}, // 's'
+  {2844, 5, 9, 0, 3, 5}, // 't'
+  {2871, 8, 7, 0, 5, 8}, // 'u'
+  {2899, 7, 7, 0, 5, 7}, // 'v'
+  {2927, 10, 7, 0, 5, 10}, // 'w'
+  {2962, 7, 7, 0, 5, 7}, // 'x'
+  {2990, 7, 10, 0, 5, 7}, // 'y'
+  {3030, 6, 7, 0, 5, 6}, // 'z'
+  {3051, 8, 11, 0, 3, 8}, // '{'
+  {3095, 4, 12, 0, 3, 4}, // '|'
+  {3119, 8, 11, 0, 3, 8}, // '}'
+  {3163, 10, 6, 0, 6, 10}, // '~'
+};
+static const Ssd1327::ProportionalFont dejaVuSans12 = {
+  15, 32, 95, dejaVuSans12_glyphs, nullptr, 0, dejaVuSans12_atlas
+};
+#endif
@@ -0,0 +1,320 @@
+// Generated by convertfont from DejaVuSansMono.ttf, 10px.
+#ifndef FONT_DEJAVUSANSMONO10_H
+#define FONT_DEJAVUSANSMONO10_H
+#include "ssd1327Font.h"
+
+static const unsigned char dejaVuSansMono10_bits[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x77, 0x00, 
+  0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0x87, 0x60, 0x05, 0x87, 0x60, 0x05, 0x87, 0x60, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x00, 0xc0, 0xc0, 
+  0x6f, 0xff, 0xff, 0x05, 0x75, 0x60, 0xff, 0xff, 0xf7, 0x0c, 0x0c, 0x00, 
+  0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 
+  0x07, 0xef, 0xf0, 0x0e, 0x36, 0x00, 0x0c, 0x98, 0x10, 0x00, 0x5b, 0xc2, 
+  0x00, 0x26, 0xa6, 0x1e, 0xef, 0xa1, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x6e, 0xb0, 0x00, 0xb2, 0x93, 0x00, 0x6e, 0xb2, 0x85, 0x01, 0x77, 0x10, 
+  0x48, 0x2b, 0xe6, 0x00, 0x3a, 0x2b, 0x00, 0x0b, 0xe6, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x06, 0xef, 0x40, 0x0c, 0x30, 0x00, 0x09, 0xa0, 0x00, 
+  0x57, 0x78, 0x0b, 0xa3, 0x0a, 0x79, 0x8a, 0x13, 0xf4, 0x1a, 0xec, 0x7a, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x20, 0x00, 0x49, 0x00, 
+  0x00, 0x94, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xc2, 0x00, 
+  0x00, 0x94, 0x00, 0x00, 0x49, 0x00, 0x00, 0x0b, 0x20, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 
+  0x00, 0x94, 0x00, 0x00, 0x49, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1e, 0x00, 
+  0x00, 0x1d, 0x00, 0x00, 0x49, 0x00, 0x00, 0x94, 0x00, 0x01, 0xb0, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x19, 0x45, 0x91, 0x03, 0xcc, 0x30, 0x03, 0xcc, 0x30, 
+  0x19, 0x45, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x66, 0x00, 0x8f, 0xff, 0xf9, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xc1, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x06, 0x80, 
+  0x00, 0x0c, 0x10, 0x00, 0x59, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x90, 0x00, 
+  0x0c, 0x20, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xdd, 0x50, 
+  0x1e, 0x33, 0xe1, 0x4b, 0x00, 0xb4, 0x5a, 0x77, 0xa5, 0x4b, 0x00, 0xb4, 
+  0x1e, 0x33, 0xe1, 0x05, 0xdd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0c, 0xfc, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 
+  0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x0a, 0xff, 0xf5, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0xed, 0x60, 0x37, 0x13, 0xf1, 0x00, 0x00, 0xe0, 
+  0x00, 0x09, 0x50, 0x00, 0x96, 0x00, 0x0a, 0x50, 0x00, 0x4f, 0xff, 0xf3, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xed, 0x50, 0x28, 0x13, 0xe0, 
+  0x00, 0x03, 0xd0, 0x01, 0xff, 0x50, 0x00, 0x02, 0xd2, 0x46, 0x12, 0xd3, 
+  0x19, 0xee, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x90, 
+  0x00, 0x88, 0x90, 0x05, 0x56, 0x90, 0x29, 0x06, 0x90, 0x7f, 0xff, 0xf8, 
+  0x00, 0x06, 0x90, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0f, 0xff, 0xb0, 0x0d, 0x00, 0x00, 0x0f, 0xed, 0x50, 0x00, 0x04, 0xe1, 
+  0x00, 0x00, 0xc3, 0x00, 0x04, 0xe1, 0x4f, 0xfd, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0xcf, 0xd0, 0x0d, 0x60, 0x00, 0x3c, 0x00, 0x00, 
+  0x5a, 0xce, 0x90, 0x4d, 0x21, 0xc4, 0x1d, 0x21, 0xc4, 0x05, 0xde, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xf3, 0x00, 0x01, 0xc0, 
+  0x00, 0x07, 0x70, 0x00, 0x0d, 0x10, 0x00, 0x5a, 0x00, 0x00, 0xb4, 0x00, 
+  0x02, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xee, 0x70, 
+  0x2e, 0x22, 0xe2, 0x1d, 0x21, 0xd1, 0x06, 0xff, 0x70, 0x3c, 0x11, 0xc3, 
+  0x4c, 0x11, 0xc4, 0x09, 0xee, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x09, 0xed, 0x50, 0x4c, 0x12, 0xd1, 0x4c, 0x12, 0xd4, 0x09, 0xec, 0xb5, 
+  0x00, 0x00, 0xc3, 0x00, 0x06, 0xd0, 0x0d, 0xfc, 0x30, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x8a, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x88, 0x05, 0xbb, 0x50, 0x8d, 0x30, 0x00, 0x05, 0xbb, 0x50, 
+  0x00, 0x02, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf9, 0x00, 0x00, 0x00, 
+  0x8f, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x30, 0x00, 0x05, 0xbb, 0x50, 
+  0x00, 0x03, 0xd9, 0x05, 0xab, 0x50, 0x79, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfe, 0x80, 0x00, 0x02, 0xe0, 
+  0x00, 0x0a, 0x80, 0x00, 0x69, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xb1, 
+  0x2d, 0x41, 0x68, 0x84, 0x4e, 0xab, 0xb0, 0xc2, 0x4b, 0xb0, 0xb0, 0x0b, 
+  0xc0, 0xc2, 0x4b, 0x85, 0x4e, 0xab, 0x2d, 0x51, 0x00, 0x03, 0xbe, 0xd0, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xbb, 0x00, 0x01, 0xbb, 0x10, 0x06, 0x76, 0x60, 0x0b, 0x22, 0xb0, 
+  0x1f, 0xff, 0xf1, 0x59, 0x00, 0x95, 0xa5, 0x00, 0x5a, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3f, 0xfe, 0x80, 0x3c, 0x01, 0xd3, 0x3c, 0x01, 0xd3, 
+  0x3f, 0xff, 0xa0, 0x3c, 0x01, 0xa6, 0x3c, 0x01, 0xa7, 0x3f, 0xfe, 0xb1, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbe, 0xa0, 0x0d, 0x61, 0x53, 
+  0x3d, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x0d, 0x61, 0x53, 
+  0x03, 0xbe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xeb, 0x30, 
+  0x5a, 0x15, 0xe1, 0x5a, 0x00, 0xb4, 0x5a, 0x00, 0xa6, 0x5a, 0x00, 0xb4, 
+  0x5a, 0x15, 0xe1, 0x5f, 0xec, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0f, 0xff, 0xf4, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0xff, 0xf2, 
+  0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0xff, 0xf6, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0d, 0xff, 0xf7, 0x0d, 0x20, 0x00, 0x0d, 0x20, 0x00, 
+  0x0d, 0xff, 0xf2, 0x0d, 0x20, 0x00, 0x0d, 0x20, 0x00, 0x0d, 0x20, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0x80, 0x1e, 0x41, 0x62, 
+  0x6a, 0x00, 0x00, 0x78, 0x09, 0xf6, 0x6a, 0x00, 0x86, 0x1e, 0x40, 0x96, 
+  0x04, 0xce, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xa5, 
+  0x5a, 0x00, 0xa5, 0x5a, 0x00, 0xa5, 0x5f, 0xff, 0xf5, 0x5a, 0x00, 0xa5, 
+  0x5a, 0x00, 0xa5, 0x5a, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0f, 0xff, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xa0, 0x00, 0x05, 0xa0, 0x00, 0x05, 0xa0, 
+  0x00, 0x05, 0xa0, 0x00, 0x05, 0xa0, 0x64, 0x19, 0x80, 0x1b, 0xec, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xb6, 0x5a, 0x0b, 0x60, 
+  0x5a, 0xb7, 0x00, 0x5f, 0xc8, 0x00, 0x5a, 0x1d, 0x30, 0x5a, 0x04, 0xd1, 
+  0x5a, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 
+  0x0e, 0x10, 0x00, 0x0e, 0x10, 0x00, 0x0e, 0x10, 0x00, 0x0e, 0x10, 0x00, 
+  0x0e, 0x10, 0x00, 0x0e, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x9d, 0x00, 0xd9, 0x9a, 0x55, 0xa9, 0x95, 0xaa, 0x59, 0x95, 0x99, 0x59, 
+  0x95, 0x00, 0x59, 0x95, 0x00, 0x59, 0x95, 0x00, 0x59, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x5f, 0x20, 0x95, 0x5d, 0x80, 0x95, 0x59, 0xc1, 0x95, 
+  0x59, 0x66, 0x95, 0x59, 0x1c, 0x95, 0x59, 0x08, 0xd5, 0x59, 0x02, 0xf5, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xde, 0x60, 0x1e, 0x32, 0xe2, 
+  0x5a, 0x00, 0xa5, 0x69, 0x00, 0x96, 0x5a, 0x00, 0xa5, 0x2e, 0x22, 0xe2, 
+  0x06, 0xee, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0xa1, 
+  0x0e, 0x01, 0xa7, 0x0e, 0x01, 0xa7, 0x0f, 0xfe, 0xb1, 0x0e, 0x00, 0x00, 
+  0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x06, 0xde, 0x60, 0x1e, 0x32, 0xe2, 0x5a, 0x00, 0xa5, 0x69, 0x00, 0x96, 
+  0x5a, 0x00, 0xa5, 0x2e, 0x22, 0xe2, 0x06, 0xef, 0x70, 0x00, 0x04, 0xa0, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x4f, 0xfe, 0x70, 0x4a, 0x03, 0xe2, 0x4a, 0x02, 0xe1, 
+  0x4f, 0xff, 0x50, 0x4a, 0x06, 0xb0, 0x4a, 0x00, 0xb4, 0x4a, 0x00, 0x4b, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xed, 0x50, 0x3d, 0x22, 0x90, 
+  0x3c, 0x00, 0x00, 0x05, 0xaa, 0x50, 0x00, 0x00, 0xb3, 0x37, 0x12, 0xc4, 
+  0x08, 0xee, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xfc, 
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x4b, 0x00, 0xa4, 0x4b, 0x00, 0xa4, 0x4b, 0x00, 0xa4, 0x4b, 0x00, 0xa4, 
+  0x4b, 0x00, 0xa4, 0x2d, 0x22, 0xd2, 0x07, 0xee, 0x70, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x96, 0x00, 0x69, 0x4b, 0x00, 0xa4, 0x0e, 0x00, 0xe0, 
+  0x0a, 0x44, 0xa0, 0x05, 0x88, 0x60, 0x01, 0xcc, 0x10, 0x00, 0xbb, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0xc2, 0x00, 0x2c, 
+  0x94, 0x99, 0x49, 0x76, 0xbb, 0x67, 0x59, 0x99, 0x95, 0x2e, 0x65, 0xe2, 
+  0x0f, 0x22, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x97, 
+  0x09, 0x63, 0xb0, 0x01, 0xcc, 0x20, 0x00, 0xac, 0x00, 0x04, 0xb9, 0x50, 
+  0x1d, 0x21, 0xd1, 0x97, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x88, 0x00, 0x88, 0x1d, 0x22, 0xd1, 0x05, 0xaa, 0x50, 0x00, 0xbb, 0x00, 
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2f, 0xff, 0xf8, 0x00, 0x01, 0xc1, 0x00, 0x09, 0x50, 
+  0x00, 0x49, 0x00, 0x01, 0xb1, 0x00, 0x0a, 0x30, 0x00, 0x3f, 0xff, 0xfb, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x50, 0x00, 0xb2, 0x00, 0x00, 0xb2, 0x00, 
+  0x00, 0xb2, 0x00, 0x00, 0xb2, 0x00, 0x00, 0xb2, 0x00, 0x00, 0xb2, 0x00, 
+  0x00, 0xb2, 0x00, 0x00, 0xbf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 
+  0x0c, 0x20, 0x00, 0x05, 0x90, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x59, 0x00, 
+  0x00, 0x0c, 0x10, 0x00, 0x06, 0x80, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfc, 0x00, 
+  0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 
+  0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x05, 0xfc, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x08, 0x77, 0x80, 0x4a, 0x00, 0x95, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00, 0x75, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xfd, 0x70, 0x00, 0x01, 0xd1, 
+  0x1a, 0xef, 0xf3, 0x4b, 0x12, 0xd3, 0x1b, 0xfb, 0xc3, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0xae, 0x90, 
+  0x1f, 0x31, 0xc4, 0x1d, 0x00, 0x86, 0x1f, 0x31, 0xc4, 0x1d, 0xae, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0xcf, 0xf3, 0x0c, 0x60, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x60, 0x00, 
+  0x03, 0xcf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0xc1, 
+  0x00, 0x00, 0xc1, 0x08, 0xeb, 0xc1, 0x3c, 0x13, 0xf1, 0x69, 0x00, 0xd1, 
+  0x3c, 0x13, 0xf1, 0x08, 0xeb, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xde, 0x80, 0x3c, 0x21, 0xb4, 
+  0x5f, 0xff, 0xf6, 0x3b, 0x20, 0x00, 0x06, 0xdf, 0xf3, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x2d, 0xf3, 0x00, 0x77, 0x00, 0x00, 0x95, 0x00, 0x1f, 0xff, 0xf3, 
+  0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0xeb, 0xc1, 0x3c, 0x13, 0xf1, 0x69, 0x00, 0xd1, 0x3c, 0x13, 0xf1, 
+  0x08, 0xeb, 0xd1, 0x00, 0x02, 0xd0, 0x0c, 0xfd, 0x50, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x00, 
+  0x1d, 0x00, 0x00, 0x1d, 0xae, 0x80, 0x1f, 0x31, 0xe1, 0x1d, 0x00, 0xc2, 
+  0x1d, 0x00, 0xc2, 0x1d, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x58, 0x00, 
+  0x00, 0x58, 0x00, 0x00, 0x58, 0x00, 0x2f, 0xff, 0xf5, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 
+  0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x4b, 0x00, 0x1f, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0d, 0x10, 0x00, 0x0d, 0x10, 0x00, 0x0d, 0x10, 0x00, 
+  0x0d, 0x13, 0xb2, 0x0d, 0x6b, 0x10, 0x0d, 0xac, 0x10, 0x0d, 0x16, 0xa0, 
+  0x0d, 0x10, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x00, 0xc2, 0x00, 
+  0x00, 0xc2, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xc2, 0x00, 
+  0x00, 0xa5, 0x00, 0x00, 0x4e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd8, 0xe3, 0x77, 0x88, 0x67, 
+  0x75, 0x67, 0x48, 0x75, 0x67, 0x48, 0x75, 0x67, 0x48, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xae, 0x80, 
+  0x1f, 0x31, 0xe1, 0x1d, 0x00, 0xc2, 0x1d, 0x00, 0xc2, 0x1d, 0x00, 0xc2, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x07, 0xee, 0x70, 0x2d, 0x22, 0xd3, 0x4a, 0x00, 0x95, 0x2d, 0x22, 0xd3, 
+  0x07, 0xee, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1d, 0xae, 0x80, 0x1f, 0x31, 0xc3, 0x1d, 0x00, 0x86, 
+  0x1f, 0x31, 0xc3, 0x1d, 0xae, 0x90, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xeb, 0xc2, 0x2d, 0x23, 0xe2, 
+  0x4a, 0x00, 0xc2, 0x2d, 0x22, 0xe2, 0x08, 0xeb, 0xc2, 0x00, 0x00, 0xb2, 
+  0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xfa, 
+  0x04, 0xe3, 0x00, 0x04, 0xa0, 0x00, 0x04, 0xa0, 0x00, 0x04, 0xa0, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x07, 0xef, 0xb0, 0x0d, 0x30, 0x00, 0x05, 0xbb, 0x60, 0x00, 0x02, 0xe0, 
+  0x0e, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 
+  0x00, 0xe0, 0x00, 0x5f, 0xff, 0xf1, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00, 
+  0x00, 0xd2, 0x00, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0xc2, 0x1d, 0x00, 0xc2, 
+  0x1d, 0x00, 0xc2, 0x0e, 0x23, 0xe2, 0x07, 0xea, 0xc2, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x95, 
+  0x0d, 0x10, 0xd0, 0x08, 0x65, 0x80, 0x02, 0xbb, 0x30, 0x00, 0xbc, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xd0, 0x00, 0x0d, 0x93, 0x00, 0x39, 0x57, 0x88, 0x76, 0x2a, 0x99, 0xa2, 
+  0x0d, 0x55, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x2c, 0x11, 0xc2, 0x04, 0xbb, 0x40, 0x00, 0xbb, 0x00, 
+  0x06, 0x99, 0x60, 0x4c, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x86, 0x0c, 0x10, 0xd1, 
+  0x06, 0x75, 0x80, 0x00, 0xcb, 0x20, 0x00, 0x8b, 0x00, 0x01, 0xb5, 0x00, 
+  0x1f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xf1, 
+  0x00, 0x05, 0x50, 0x00, 0x55, 0x00, 0x04, 0x60, 0x00, 0x0e, 0xff, 0xf1, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x00, 0x59, 0x00, 0x00, 0x67, 0x00, 
+  0x00, 0x96, 0x00, 0x0e, 0xe1, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x67, 0x00, 
+  0x00, 0x59, 0x00, 0x00, 0x2c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc2, 0x00, 
+  0x00, 0x96, 0x00, 0x00, 0x76, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1e, 0xe0, 
+  0x00, 0x6a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x96, 0x00, 0x0e, 0xc2, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x3d, 0xd4, 0x26, 0x62, 0x3c, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const Ssd1327::Font dejaVuSansMono10 = {
+  6, 13, 32, 95, dejaVuSansMono10_bits
+};
+#endif
@@ -1,9 +1,42 @@
 #include "ssd1327.h"
-#include <stdlib.h>
-#include <Arduino.h>
+#include "ssd1327FrameBuffer.h"
+#include "ssd1327Init.h"
+#include "ssd1327Nibbles.h"
+#include "ssd1327Rle.h"
+#include <string.h>
 
 using namespace Ssd1327;
 
+const InitSequence Ssd1327::defaultInitSequence SSD1327_PROGMEM =
+  InitConfig().build();
+
+// Most interfaces don't need to do anything on begin.
+void Interface::begin() {}
+
+// Bursts are optional, sendData calls are sent as they are by default.
+void Interface::beginBurst() {}
+uint8_t Interface::endBurst() {
+  return 0;
+}
+
+DmaInterface* Interface::getDma() {
+  return nullptr;
+}
+
+DmaInterface* DmaInterface::getDma() {
+  return this;
+}
+
+void DmaInterface::setCallback(Callback callback, void* context) {
+  _callback = callback;
+  _context = context;
+}
+
+void DmaInterface::_complete(uint8_t status) {
+  Callback callback = _callback;
+  if (callback != nullptr) callback(_context, status);
+}
+
 // Default implementation only returns false to indicate a software reset is
 // required.
 bool Interface::hwReset() {
@@ -13,102 +46,296 @@ bool Interface::hwReset() {
 Implementation::Implementation(uint8_t width, uint8_t height):
   _width(width), _height(height) {}
 
+void Implementation::beginCommandBatch() {
+  _batchDepth++;
+}
+
+uint8_t Implementation::endCommandBatch() {
+  if (_batchDepth > 0) _batchDepth--;
+  if (_batchDepth > 0) return 0;
+  return flushCommands();
+}
+
+uint8_t Implementation::flushCommands() {
+  if (_queued == 0) return 0;
+  uint8_t len = _queued;
+  _queued = 0;
+  return interface->sendCommand(_commandQueue, len);
+}
+
+uint8_t Implementation::sendCommand(uint8_t command) {
+  return sendCommand(&command, 1);
+}
+
+uint8_t Implementation::sendCommand(uint8_t* command, uint8_t len) {
+  if (_batchDepth == 0) {
+    uint8_t error = flushCommands();
+    return error | interface->sendCommand(command, len);
+  }
+  uint8_t error = 0;
+  if (_queued + len > SSD1327_COMMAND_QUEUE) {
+    error = flushCommands();
+    // Doesn't fit in an empty queue either.
+    if (len > SSD1327_COMMAND_QUEUE) {
+      return error | interface->sendCommand(command, len);
+    }
+  }
+  for (uint8_t i = 0; i < len; i++) {
+    _commandQueue[_queued++] = command[i];
+  }
+  return error;
+}
+
+uint8_t Implementation::sendData(uint8_t* data, uint16_t len) {
+  // Commands must reach the display before the data they apply to.
+  uint8_t error = flushCommands();
+  if (error != 0) return error;
+  _advanceWindow(len);
+  error = interface->sendData(data, len);
+  // The address pointer is unknown if the transfer failed halfway.
+  if (error != 0) _invalidateWindow();
+  return error;
+}
+
+uint8_t Implementation::sendDataAsync(uint8_t* data, uint16_t len) {
+  DmaInterface* dma = interface->getDma();
+  if (dma == nullptr) return ERROR_INVALID_ARGUMENT;
+  uint8_t error = flushCommands();
+  if (error != 0) return error;
+  // The transfer may complete before sendDataAsync returns.
+  _advanceWindow(len);
+  error = dma->sendDataAsync(data, len);
+  if (error != 0) _invalidateWindow();
+  return error;
+}
+
+/**
+ * Keep track of the address pointer in the window, it's back at the start
+ * when the window is filled exactly.
+ */
+void Implementation::_advanceWindow(uint16_t len) {
+  uint16_t size = _windowSize();
+  if (size > 0 && len > 0 && _writtenKnown) {
+    _written = (_written + len % size) % size;
+    _columnAtStart = _rowAtStart = _written == 0;
+  } else if (len > 0) {
+    _columnAtStart = _rowAtStart = false;
+  }
+}
+
+void Implementation::invalidate() {
+  _shadowValid = 0;
+  _invalidateWindow();
+}
+
+bool Implementation::_isCached(Register reg, uint8_t value) {
+  uint32_t mask = (uint32_t)1 << (uint8_t)reg;
+  return (_shadowValid & mask) && _shadow[(uint8_t)reg] == value;
+}
+
+void Implementation::_cache(Register reg, uint8_t value) {
+  _shadow[(uint8_t)reg] = value;
+  _shadowValid |= (uint32_t)1 << (uint8_t)reg;
+}
+
+void Implementation::_uncache(Register reg) {
+  _shadowValid &= ~((uint32_t)1 << (uint8_t)reg);
+}
+
+uint8_t Implementation::_setRegister(
+  Register reg, Cmd command, uint8_t value
+) {
+  if (_isCached(reg, value)) return 0;
+  _cache(reg, value);
+  uint8_t buffer[2] = {(uint8_t)command, value};
+  uint8_t error = sendCommand(buffer, 2);
+  if (error != 0) _uncache(reg);
+  return error;
+}
+
+/**
+ * Registers that are set by commands without arguments, like the display
+ * mode, cache the command itself.
+ */
+uint8_t Implementation::_setRegister(Register reg, Cmd command) {
+  if (_isCached(reg, (uint8_t)command)) return 0;
+  _cache(reg, (uint8_t)command);
+  uint8_t error = sendCommand((uint8_t)command);
+  if (error != 0) _uncache(reg);
+  return error;
+}
+
+/**
+ * Setting a range also moves the address pointer to the start of the range,
+ * so a range can only be skipped if the pointer is at its start already,
+ * e.g. after a window was filled exactly.
+ */
+uint8_t Implementation::_setWindow(
+  Register startReg, Cmd command, uint8_t start, uint8_t end
+) {
+  Register endReg = (Register)((uint8_t)startReg + 1);
+  bool *atStart = startReg == Register::ColumnStart ?
+    &_columnAtStart : &_rowAtStart;
+  bool *otherAtStart = startReg == Register::ColumnStart ?
+    &_rowAtStart : &_columnAtStart;
+  if (*atStart && _isCached(startReg, start) && _isCached(endReg, end)) {
+    return 0;
+  }
+  _cache(startReg, start);
+  _cache(endReg, end);
+  *atStart = true;
+  // Only this axis moves back to its start. If the other one is somewhere in
+  // the window the position is unknown until its range is sent too.
+  _writtenKnown = *otherAtStart;
+  _written = 0;
+  uint8_t buffer[3] = {(uint8_t)command, start, end};
+  uint8_t error = sendCommand(buffer, 3);
+  if (error != 0) _invalidateWindow();
+  return error;
+}
+
+void Implementation::_invalidateWindow() {
+  _uncache(Register::ColumnStart);
+  _uncache(Register::ColumnEnd);
+  _uncache(Register::RowStart);
+  _uncache(Register::RowEnd);
+  _columnAtStart = false;
+  _rowAtStart = false;
+  _written = 0;
+  _writtenKnown = false;
+}
+
+// Size of the address window in bytes, 0 if unknown.
+uint16_t Implementation::_windowSize() {
+  uint32_t window = (1UL << (uint8_t)Register::ColumnStart) |
+    (1UL << (uint8_t)Register::ColumnEnd) |
+    (1UL << (uint8_t)Register::RowStart) |
+    (1UL << (uint8_t)Register::RowEnd);
+  if ((_shadowValid & window) != window) return 0;
+  uint8_t columnStart = _shadow[(uint8_t)Register::ColumnStart];
+  uint8_t columnEnd = _shadow[(uint8_t)Register::ColumnEnd];
+  uint8_t rowStart = _shadow[(uint8_t)Register::RowStart];
+  uint8_t rowEnd = _shadow[(uint8_t)Register::RowEnd];
+  if (columnEnd < columnStart || rowEnd < rowStart) return 0;
+  return (uint16_t)(columnEnd - columnStart + 1) * (rowEnd - rowStart + 1);
+}
+
 
 uint8_t Implementation::setColumnRange(uint8_t start, uint8_t end) {
-  start &= 0x3f; // 6-bit value
-  end &= 0x3f; // 6-bit value
-  uint8_t buffer[3] = {(uint8_t)Cmd::SetColumnRange, start, end};
-  return interface->sendCommand(buffer, 3);
+  start = (start + _columnOffset) & 0x3f; // 6-bit value
+  end = (end + _columnOffset) & 0x3f; // 6-bit value
+  return _setWindow(Register::ColumnStart, Cmd::SetColumnRange, start, end);
 }
 uint8_t Implementation::setRowRange(uint8_t start, uint8_t end) {
   start &= 0x7f; // 7-bit value
   end &= 0x7f; // 7-bit value
-  uint8_t buffer[3] = {(uint8_t)Cmd::SetRowRange, start, end};
-  return interface->sendCommand(buffer, 3);
+  return _setWindow(Register::RowStart, Cmd::SetRowRange, start, end);
 }
 uint8_t Implementation::resetRange() {
-  uint8_t buffer[3] = {
-    (uint8_t) Cmd::SetColumnRange, 0x00, (uint8_t) (_width / 2 -1)
-  };
-  return interface->sendCommand(buffer, 3);
-  buffer[0] = (uint8_t)Cmd::SetRowRange;
-  buffer[1] = _height - 1;
-  return interface->sendCommand(buffer, 3);
+  uint8_t error = 0;
+  error |= setColumnRange(0x00, _width / 2 - 1);
+  error |= setRowRange(0x00, _height - 1);
+  return error;
 }
 
 uint8_t Implementation::setDisplayOff() {
-  delay(1);
-  return interface->sendCommand((uint8_t)Cmd::DisplayOff);
+  if (_isCached(Register::DisplayPower, (uint8_t)Cmd::DisplayOff)) return 0;
+  _waitms(1);
+  return _setRegister(Register::DisplayPower, Cmd::DisplayOff);
 }
 
 uint8_t Implementation::setDisplayOn() {
-  uint8_t ret = interface->sendCommand((uint8_t)Cmd::DisplayOn);
-  delay(1);
+  if (_isCached(Register::DisplayPower, (uint8_t)Cmd::DisplayOn)) return 0;
+  uint8_t ret = _setRegister(Register::DisplayPower, Cmd::DisplayOn);
+  _waitms(1);
   return ret;
 }
 
 uint8_t Implementation::setRemapping(
   bool comSplitOddEven,
   bool comRemapping,
-  bool horizontalAddressIncrement,
+  bool verticalAddressIncrement,
   bool nibbleRemapping,
   bool gddrRemapping
 ) {
-  uint8_t buffer[2] {(uint8_t)Cmd::SetRemapping, 0};
+  uint8_t remapping = 0;
   if (comSplitOddEven)
-    buffer[1] |= (uint8_t) Const::ComSplitOddEvenOnMask;
+    remapping |= (uint8_t) Const::ComSplitOddEvenOnMask;
   if (comRemapping)
-    buffer[1] |= (uint8_t) Const::ComRemappingOnMask;
-  if (horizontalAddressIncrement)
-    buffer[1] |= (uint8_t) Const::HorizontalAddressIncrementMask;
+    remapping |= (uint8_t) Const::ComRemappingOnMask;
+  if (verticalAddressIncrement)
+    remapping |= (uint8_t) Const::VerticalAddressIncrementMask;
   if (nibbleRemapping)
-    buffer[1] |= (uint8_t) Const::NibbleRemappingOnMask;
+    remapping |= (uint8_t) Const::NibbleRemappingOnMask;
   if (gddrRemapping)
-    buffer[1] |= (uint8_t) Const::GddrRemappingOnMask;
-  return interface->sendCommand(buffer, 2);
+    remapping |= (uint8_t) Const::GddrRemappingOnMask;
+  return _setRegister(Register::Remapping, Cmd::SetRemapping, remapping);
 }
 
 uint8_t Implementation::resetRemapping() {
   return setRemapping(true, true, false, false, true);
 }
 
+uint8_t Implementation::setRotation(uint16_t degrees) {
+  if (degrees % 90 != 0 || degrees >= 360) return ERROR_INVALID_ARGUMENT;
+  uint8_t error = 0;
+  // The scroll area was set up for the old rotation, stop while the shadow
+  // buffer still matches it.
+  if (_scrolling) error |= deactivateScroll();
+  _scrollSet = false;
+  _rotation = degrees;
+  _columnOffset = degrees >= 180 ? SSD1327_GDDRAM_COLUMNS - _width / 2 : 0;
+  return error | setVerticalAddressIncrement(false);
+}
+
+uint16_t Implementation::getRotation() {
+  return _rotation;
+}
+
+/**
+ * The reset remapping shows the image upright, turning it by 180 degrees
+ * toggles the COM, column and nibble remapping.
+ */
+uint8_t Implementation::setVerticalAddressIncrement(bool vertical) {
+  bool turned = _rotation >= 180;
+  return setRemapping(true, !turned, vertical, turned, !turned);
+}
+
 uint8_t Implementation::setContrastLevel(uint8_t level) {
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetContrastLevel, level};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::ContrastLevel, Cmd::SetContrastLevel, level);
 }
 
 uint8_t Implementation::setStartLine(uint8_t line) {
   line &= 0x7f; // 7-bit value
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetStartLine, line};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::StartLine, Cmd::SetStartLine, line);
 }
 
 uint8_t Implementation::setDisplayOffset(uint8_t offset) {
   offset &= 0x7f; // 7-bit value
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetDisplayOffset, offset};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(
+    Register::DisplayOffset, Cmd::SetDisplayOffset, offset
+  );
 }
 
 uint8_t Implementation::setDisplayNormal() {
-  return interface->sendCommand((uint8_t)Cmd::SetDisplayNormal);
+  return _setRegister(Register::DisplayMode, Cmd::SetDisplayNormal);
 }
 
 uint8_t Implementation::setDisplayAllOn() {
-  return interface->sendCommand((uint8_t)Cmd::SetDisplayAllOn);
+  return _setRegister(Register::DisplayMode, Cmd::SetDisplayAllOn);
 }
 
 uint8_t Implementation::setDisplayAllOff() {
-  return interface->sendCommand((uint8_t)Cmd::SetDisplayAllOff);
+  return _setRegister(Register::DisplayMode, Cmd::SetDisplayAllOff);
 }
 
 uint8_t Implementation::setDisplayInverse() {
-  return interface->sendCommand((uint8_t)Cmd::SetDisplayInverse);
+  return _setRegister(Register::DisplayMode, Cmd::SetDisplayInverse);
 }
 
 uint8_t Implementation::setMuxRatio(uint8_t ratio) {
   ratio &= 0x7f;
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetMuxRatio, ratio};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::MuxRatio, Cmd::SetMuxRatio, ratio);
 }
 
 uint8_t Implementation::resetMuxRatio() {
@@ -117,14 +344,12 @@ uint8_t Implementation::resetMuxRatio() {
 
 uint8_t Implementation::enableVddRegulator(bool state) {
   uint8_t _state = (state ? 1 : 0 );
-   uint8_t buffer[2] = {(uint8_t)Cmd::EnableVddRegulator, _state};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::VddRegulator, Cmd::EnableVddRegulator, _state);
 }
 
 uint8_t Implementation::setPhaseLength(uint8_t phaseLen) {
   _phaseLen = phaseLen;
-   uint8_t buffer[2] = {(uint8_t)Cmd::SetPhaseLength, phaseLen};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::PhaseLength, Cmd::SetPhaseLength, phaseLen);
 }
 
 uint8_t Implementation::setPixelResetPeriod(uint8_t period) {
@@ -145,19 +370,19 @@ uint8_t Implementation::setFirstPrechargePeriod(uint8_t period) {
 uint8_t Implementation::setSecondPrechargePeriod(uint8_t period) {
   if (period < 1) period = 1;
   period &= 0x0f;
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetSecondPrechargePeriod, period};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(
+    Register::SecondPrechargePeriod, Cmd::SetSecondPrechargePeriod, period
+  );
 }
 
 uint8_t Implementation::sendNoOp() {
-  return interface->sendCommand((uint8_t)Cmd::SendNoOp);
+  return sendCommand((uint8_t)Cmd::SendNoOp);
 }
 
 uint8_t Implementation::setDisplayClock(uint8_t clock, uint8_t divider) {
   clock <<= 4;
   clock |= divider;
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetDisplayClock, clock};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::DisplayClock, Cmd::SetDisplayClock, clock);
 }
 
 uint8_t Implementation::setGpioMode(GpioMode mode) {
@@ -170,8 +395,7 @@ uint8_t Implementation::setGpio(bool state) {
   uint8_t _state = (uint8_t) GpioMode::Output;
   if (state)
     _state |= 0b01;
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetGpio, _state};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::Gpio, Cmd::SetGpio, _state);
 }
 
 uint8_t Implementation::setGrayscaleLevels(uint8_t* grayScaleMap) {
@@ -180,27 +404,30 @@ uint8_t Implementation::setGrayscaleLevels(uint8_t* grayScaleMap) {
   for (uint8_t i = 0; i < 14; i++) {
     buffer[i+1] = *(grayScaleMap+i);
   }
-  return interface->sendCommand(buffer, 16);
+  return sendCommand(buffer, 16);
 }
 
 uint8_t Implementation::resetGrayscale() {
-  return interface->sendCommand((uint8_t)Cmd::resetGrayscale);
+  return sendCommand((uint8_t)Cmd::resetGrayscale);
 }
 
 uint8_t Implementation::setPreChargeVoltage(uint8_t voltage) {
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetPreChargeVoltage, voltage};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(
+    Register::PreChargeVoltage, Cmd::SetPreChargeVoltage, voltage
+  );
 }
 
 uint8_t Implementation::setComDeselectVoltage(uint8_t voltage) {
-  uint8_t buffer[2] = {(uint8_t)Cmd::SetComDeselectVoltage, voltage};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(
+    Register::ComDeselectVoltage, Cmd::SetComDeselectVoltage, voltage
+  );
 }
 
 uint8_t Implementation::functionSelectionB(uint8_t selection) {
   selection |= (uint8_t) Const::FunctionSelectionBBase;
-  uint8_t buffer[2] = {(uint8_t)Cmd::FunctionSelectionB, selection};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(
+    Register::FunctionSelectionB, Cmd::FunctionSelectionB, selection
+  );
 }
 
 uint8_t Implementation::enableSecondPrecharge(bool state) {
@@ -223,39 +450,128 @@ uint8_t Implementation::mcuProtectEnable() {
    uint8_t state = (
      (uint8_t)Const::McuProtectEnableBase | (uint8_t)Const::McuProtectLockMask
     );
-  uint8_t buffer[2] = {(uint8_t)Cmd::McuProtectEnable, state};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::McuProtect, Cmd::McuProtectEnable, state);
 }
 
 uint8_t Implementation::mcuProtectDisable() {
   uint8_t state = (uint8_t) Const::McuProtectEnableBase; // base is unlock
-  uint8_t buffer[2] = {(uint8_t)Cmd::McuProtectEnable, state,};
-  return interface->sendCommand(buffer, 2);
+  return _setRegister(Register::McuProtect, Cmd::McuProtectEnable, state);
+}
+
+uint8_t Implementation::scrollVertically(int8_t lines, int8_t level) {
+  if (lines == 0) return 0;
+  uint8_t error = _knowStartLine();
+  if (error != 0) return error;
+  uint8_t start = _shadow[(uint8_t)Register::StartLine];
+  error = setStartLine(start + lines);
+  if (error != 0 || level < 0) return error;
+  uint8_t exposed = lines < 0 ? -lines : lines;
+  if (exposed > _height) exposed = _height;
+  uint8_t y = lines < 0 ? 0 : _height - exposed;
+  return fillRect(0, y, _width, exposed, level);
 }
 
 uint8_t Implementation::clear() {
+  return fillRect(0, 0, _width, _height, 0);
+}
+
+bool Implementation::_isKnown(Register reg) {
+  return _shadowValid & ((uint32_t)1 << (uint8_t)reg);
+}
+
+/**
+ * Display lines are translated to GDDRAM rows with the start line, if it's
+ * unknown it's set to 0.
+ */
+uint8_t Implementation::_knowStartLine() {
+  if (_isKnown(Register::StartLine)) return 0;
+  return setStartLine(0);
+}
+
+uint8_t Implementation::_lineToRow(uint8_t line) {
+  uint8_t start = _shadow[(uint8_t)Register::StartLine];
+  return (start + line) % SSD1327_GDDRAM_ROWS;
+}
+
+uint8_t Implementation::fillRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+) {
+  if (x >= _width || y >= _height) return 0;
+  if ((uint16_t)x + width > _width) width = _width - x;
+  if ((uint16_t)y + height > _height) height = _height - y;
+  if (width == 0 || height == 0) return 0;
+  uint8_t error = _knowStartLine();
+  if (error != 0) return error;
+  // GDDRAM is a ring, a rectangle can wrap around its last row.
+  uint8_t row = _lineToRow(y);
+  uint8_t first = height;
+  if (row + height > SSD1327_GDDRAM_ROWS) first = SSD1327_GDDRAM_ROWS - row;
+  error = _fillRows(x, row, width, first, level);
+  if (error == 0 && first < height) {
+    error = _fillRows(x, 0, width, height - first, level);
+  }
+  return error;
+}
+
+uint8_t Implementation::_fillRows(
+  uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t level
+) {
   uint8_t error = 0;
-  // Calculate number of bytes required to clear the display.
-  // width * height / 2 => one nibble per pixel divided by buffer length
-  uint16_t numBytes = _width * _height / 2;
-  // Calculate how many buffers we need to send to clear the display.
-  // NOTE: Theoretically the buffer could bigger than numBytes, that's ok, 0
-  //       buffers will be sent.
-  uint16_t numBuffers = numBytes / (1024 - 2);
-  // Calculate the remainder of bytes after the buffers are sent.
-  numBytes = numBytes % (128 - 2);
-  uint8_t *buffer = (uint8_t*)calloc (1024, sizeof(uint8_t));
-  // Clear by buffer length.
-  for (uint16_t buf = 0; buf <= numBuffers; buf++)
-  {
-    error |= interface->sendData(buffer, 1024);
+  level &= 0x0f;
+  uint8_t pattern = level << 4 | level;
+  uint8_t segments = (x + width - 1) / 2 - x / 2 + 1;
+  bool leading = x % 2;
+  bool trailing = (x + width) % 2;
+  // Window setup goes out in one transaction.
+  beginCommandBatch();
+  setRowRange(row, row + height - 1);
+  setColumnRange(x / 2, (x + width - 1) / 2);
+  error = endCommandBatch();
+  if (error != 0) return error;
+  // The window wraps to the next row by itself, rows are packed into the
+  // buffer back to back so every sendData call is a full buffer.
+  uint8_t buffer[SSD1327_DATA_BUFFER];
+  uint16_t used = 0;
+  interface->beginBurst();
+  for (uint8_t i = 0; i < height && error == 0; i++) {
+    uint8_t done = 0;
+    while (done < segments) {
+      if (used == SSD1327_DATA_BUFFER) {
+        error = sendData(buffer, used);
+        if (error != 0) break;
+        used = 0;
+      }
+      uint8_t n = segments - done;
+      if (n > SSD1327_DATA_BUFFER - used) n = SSD1327_DATA_BUFFER - used;
+      memset(buffer + used, pattern, n);
+      if (done == 0 && leading) {
+        uint8_t other = 0;
+        if (_shadowBuffer != nullptr) {
+          other = _shadowBuffer->getPixel(x - 1, row + i);
+        }
+        buffer[used] = other << 4 | level;
+      }
+      if (done + n == segments && trailing) {
+        uint8_t other = 0;
+        if (_shadowBuffer != nullptr) {
+          other = _shadowBuffer->getPixel(x + width, row + i);
+        }
+        buffer[used + n - 1] = level << 4 | other;
+      }
+      used += n;
+      done += n;
+    }
   }
-  // Clear remainder
-  for (uint16_t i = 0; i < numBytes; i++) 
-  {
-    error |= interface->sendData(buffer, numBytes);
+  if (error == 0 && used > 0) error = sendData(buffer, used);
+  uint8_t burstError = interface->endBurst();
+  if (error == 0) error = burstError;
+  if (_shadowBuffer != nullptr) {
+    if (error == 0) {
+      _shadowBuffer->updateRect(x, row, width, height, level);
+    } else {
+      _shadowBuffer->fillRect(x, row, width, height, level);
+    }
   }
-  free(buffer);
   return error;
 }
 
@@ -267,129 +583,331 @@ uint8_t Implementation::getWidth()
 {
   return _width;
 }
-/**
- * Can't just send data to the screen because a pixel is nibble and segments
- * are 2 pixels wide. If the image width is uneven, the last segment of each
- * line will contain both the last pixel of the lina and the first pixel of the
- * next. That will cause a skew in the image.
- */
+void Implementation::setShadowBuffer(FrameBuffer* shadow) {
+  _shadowBuffer = shadow;
+}
+
+FrameBuffer* Implementation::getShadowBuffer() {
+  return _shadowBuffer;
+}
+
 uint8_t Implementation::renderImageData(
   uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t *image,
   uint16_t len
 ) {
-  uint8_t error = 0;
-  error = setRowRange(y, y + height - 1);
-  if (error != 0) return error;
-  error = setColumnRange(x / 2, (x + width) / 2 - 1 + (width % 2));
+  if (width == 0 || height == 0) return 0;
+  if (len < ((uint32_t)width * height + 1) / 2) return ERROR_INVALID_ARGUMENT;
+  uint8_t error = _knowStartLine();
   if (error != 0) return error;
-  error = setStartLine(0);
+  // GDDRAM is a ring, the bottom of the image may wrap around to row 0.
+  uint8_t row = _lineToRow(y);
+  uint8_t first = height;
+  if (row + height > SSD1327_GDDRAM_ROWS) first = SSD1327_GDDRAM_ROWS - row;
+  error = _renderRows(x, row, width, first, image, 0);
+  if (error == 0 && first < height) {
+    error = _renderRows(
+      x, 0, width, height - first, image, (uint32_t)first * width
+    );
+  }
+  return error;
+}
+
+uint8_t Implementation::renderCompressedImage(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *data,
+  uint32_t len
+) {
+  if (width == 0 || height == 0) return 0;
+  uint8_t error = _knowStartLine();
   if (error != 0) return error;
-  if (width % 2 == 0) {
-    return interface->sendData(image, len);
+  // Lines of an even width at an even x are whole segments and rows that
+  // don't wrap around are one window: set it once and send every chunk as
+  // it's decoded. Otherwise every chunk is rendered like image data.
+  uint8_t row = _lineToRow(y);
+  bool stream = x % 2 == 0 && width % 2 == 0 &&
+    row + height <= SSD1327_GDDRAM_ROWS;
+  if (stream) {
+    beginCommandBatch();
+    setRowRange(row, row + height - 1);
+    setColumnRange(x / 2, (x + width - 1) / 2);
+    error = endCommandBatch();
+    if (error != 0) return error;
+    interface->beginBurst();
   }
-  // This will be way less efficient because it requires several operations on
-  // half of the image's bytes.
-  uint8_t bufLen = width / 2 + 1;
-  uint8_t carry = 0;
-  uint8_t *buffer = (uint8_t*) malloc(bufLen);
-  uint16_t sent = 0;
-  bool even = true;
-  // Loop through the entire image by line buffer. Carry the last bytes of
-  // every even line and null in its last nibble in the line buffer. 
-  // On uneven lines offset the pointer of the line buffer by +1 and read the
-  // line buffer length minus 1 into it. Now put the carried byte into the
-  // line buffer at the first byte. Now shift every byte of the line buffer 4
-  // bits left. This implicitly sets the last nibble to 0x0. 
-  
-  while(len > 0)
-  {
-    if (len < bufLen) {
-      std::copy_n(image + sent, bufLen, buffer);
-      buffer[len-1] &= 0xf0;
+  RleDecoder decoder(data, len);
+  uint8_t buffer[SSD1327_RLE_BUFFER];
+  // As many lines as fit, an even number for uneven widths so every chunk
+  // starts on a byte boundary. An uneven width too wide for 2 lines is
+  // decoded and rendered a line at a time, every read starts at the first
+  // byte of the buffer.
+  uint16_t lines = SSD1327_RLE_BUFFER * 2 / width;
+  if (width % 2) lines &= ~1;
+  if (lines == 0) lines = 1;
+  for (uint16_t line = 0; line < height && error == 0; line += lines) {
+    uint8_t n = height - line < lines ? height - line : lines;
+    uint16_t pixels = (uint16_t)n * width;
+    if (decoder.read(buffer, pixels) < pixels) {
+      error = ERROR_INVALID_ARGUMENT;
       break;
-    } else if (even) {
-      std::copy_n(image + sent, bufLen, buffer);
-      carry = buffer[bufLen-1];
-      buffer[bufLen-1] &= 0xf0;
-      len -= bufLen;
-      sent += bufLen;
+    }
+    if (!stream) {
+      error = renderImageData(x, y + line, width, n, buffer, (pixels + 1) / 2);
+      continue;
+    }
+    error = sendData(buffer, pixels / 2);
+    if (_shadowBuffer != nullptr) {
+      // Same as _renderRows, a failed chunk is repaired by the next flush.
+      if (error == 0) {
+        _shadowBuffer->updateImage(x, row + line, width, n, buffer);
+      } else {
+        _shadowBuffer->drawImage(x, row + line, width, n, buffer);
+      }
+    }
+  }
+  if (stream) {
+    uint8_t burstError = interface->endBurst();
+    if (error == 0) error = burstError;
+  }
+  return error;
+}
+
+/**
+ * Render the lines of an image from a nibble offset on, to GDDRAM rows that
+ * don't wrap around.
+ */
+uint8_t Implementation::_renderRows(
+  uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t *image,
+  uint32_t offset
+) {
+  uint8_t error = 0;
+  // Window setup goes out in one transaction.
+  beginCommandBatch();
+  setRowRange(row, row + height - 1);
+  setColumnRange(x / 2, (x + width - 1) / 2);
+  error = endCommandBatch();
+  if (error != 0) return error;
+  if (x % 2 == 0 && width % 2 == 0) {
+    // Lines of an even width start on a byte boundary.
+    error = sendData(image + offset / 2, (uint16_t)(width / 2) * height);
+  } else {
+    error = _sendRealigned(x, row, width, height, image, offset);
+  }
+  if (_shadowBuffer != nullptr) {
+    // If sending failed the display is in an unknown state, mark the image
+    // dirty so the next flush of the shadow buffer repairs it.
+    if (error == 0) {
+      _shadowBuffer->updateImage(x, row, width, height, image, offset);
     } else {
-      std::copy_n(image + sent, bufLen - 1, ++buffer);
-      --buffer;
-      buffer[0] = carry;
-      for (uint8_t j = 0; j < bufLen-1; j++) 
-      {
-        buffer[j] = buffer[j+1] >> 4 | buffer[j] << 4;
+      _shadowBuffer->drawImage(x, row, width, height, image, offset);
+    }
+  }
+  return error;
+}
+
+/**
+ * Can't just send data to the screen because a pixel is nibble and segments
+ * are 2 pixels wide. If the image width is uneven, the last segment of each
+ * line will contain both the last pixel of the line and the first pixel of the
+ * next. That will cause a skew in the image, the same goes for images at an
+ * uneven x. Lines are realigned into a stack buffer, the half segments at the
+ * start and end of lines are completed with the pixel from the shadow buffer
+ * (or 0) and streamed to the display.
+ */
+uint8_t Implementation::_sendRealigned(
+  uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t *image,
+  uint32_t offset
+) {
+  uint8_t error = 0;
+  uint8_t buffer[SSD1327_DATA_BUFFER];
+  uint16_t used = 0;
+  bool leading = x % 2;
+  bool trailing = (x + width) % 2;
+  interface->beginBurst();
+  for (uint8_t i = 0; i < height && error == 0; i++) {
+    uint8_t remaining = width;
+    while (remaining > 0) {
+      if (used == SSD1327_DATA_BUFFER) {
+        error = sendData(buffer, used);
+        if (error != 0) break;
+        used = 0;
+      }
+      if (leading && remaining == width) {
+        uint8_t level = 0;
+        if (_shadowBuffer != nullptr) {
+          level = _shadowBuffer->getPixel(x - 1, row + i);
+        }
+        buffer[used++] = level << 4 | Nibbles::get(image, offset++);
+        remaining--;
+        continue;
+      }
+      // Whole bytes only, unless it's the end of the line.
+      uint16_t space = (SSD1327_DATA_BUFFER - used) * 2;
+      uint16_t count = remaining < space ? remaining : space;
+      Nibbles::copy(buffer + used, image, offset, count);
+      used += (count + 1) / 2;
+      offset += count;
+      remaining -= count;
+      if (remaining == 0 && trailing && _shadowBuffer != nullptr) {
+        buffer[used - 1] |= _shadowBuffer->getPixel(x + width, row + i);
       }
-      buffer[bufLen-1] <<= 4;
-      len -= (bufLen - 1);
-      sent += (bufLen - 1);
     }
-    even = !even;
-    error = interface->sendData(buffer, bufLen);
-    if (error != 0) return error;
   }
-  free(buffer);
+  if (error == 0 && used > 0) error = sendData(buffer, used);
+  uint8_t burstError = interface->endBurst();
+  return error != 0 ? error : burstError;
+}
+
+uint8_t Implementation::setHorizontalScrollRight(
+  uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart, uint8_t rowEnd,
+  ScrollSpeed speed
+) {
+  return _setHorizontalScroll(
+    Cmd::SetHorizontalScrollRight, columnStart, columnEnd, rowStart, rowEnd,
+    speed
+  );
+}
+
+uint8_t Implementation::setHorizontalScrollLeft(
+  uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart, uint8_t rowEnd,
+  ScrollSpeed speed
+) {
+  return _setHorizontalScroll(
+    Cmd::SetHorizontalScrollLeft, columnStart, columnEnd, rowStart, rowEnd,
+    speed
+  );
+}
+
+uint8_t Implementation::_setHorizontalScroll(
+  Cmd command, uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart,
+  uint8_t rowEnd, ScrollSpeed speed
+) {
+  columnStart &= 0x3f; // 6-bit value
+  columnEnd &= 0x3f; // 6-bit value
+  rowStart &= 0x7f; // 7-bit value
+  rowEnd &= 0x7f; // 7-bit value
+  // Turned by 90 degrees panel columns are lines of the frame.
+  if (columnEnd < columnStart || rowEnd < rowStart || _rotation % 180 != 0) {
+    return ERROR_INVALID_ARGUMENT;
+  }
+  uint8_t error = 0;
+  // Stopping and the new setup go out in one transaction.
+  beginCommandBatch();
+  if (_scrolling) error |= deactivateScroll();
+  // Column addresses like setColumnRange, the area is kept without the
+  // offset, in the coordinates of the shadow buffer.
+  uint8_t buffer[8] = {
+    (uint8_t)command, 0x00, rowStart, (uint8_t)speed, rowEnd,
+    (uint8_t)((columnStart + _columnOffset) & 0x3f),
+    (uint8_t)((columnEnd + _columnOffset) & 0x3f), 0x00
+  };
+  error |= sendCommand(buffer, 8);
+  error |= endCommandBatch();
+  _scrollArea[0] = columnStart;
+  _scrollArea[1] = columnEnd;
+  _scrollArea[2] = rowStart;
+  _scrollArea[3] = rowEnd;
+  _scrollSet = error == 0;
+  return error;
+}
+
+uint8_t Implementation::activateScroll() {
+  if (!_scrollSet) return ERROR_INVALID_ARGUMENT;
+  uint8_t error = sendCommand((uint8_t)Cmd::ActivateScroll);
+  // Even if the transmission failed it may have started.
+  _scrolling = true;
+  return error;
+}
+
+uint8_t Implementation::deactivateScroll() {
+  uint8_t error = sendCommand((uint8_t)Cmd::DectivateScroll);
+  _invalidateScrollArea();
+  if (error == 0) _scrolling = false;
   return error;
 }
 
-// uint8_t Implementation::setHorizontalScrollRight() {
-// }
-// uint8_t Implementation::setHorizontalScrollLeft() {
-// }
-// uint8_t Implementation::activateScroll() {
-// }
-// uint8_t Implementation::dectivateScroll() {
-//}
+// The scrolled area is left at an unknown position when scrolling stops.
+void Implementation::_invalidateScrollArea() {
+  if (_scrolling && _shadowBuffer != nullptr) {
+    _shadowBuffer->invalidate(
+      _scrollArea[0] * 2, _scrollArea[2],
+      (_scrollArea[1] - _scrollArea[0] + 1) * 2,
+      _scrollArea[3] - _scrollArea[2] + 1
+    );
+  }
+}
+
+bool Implementation::isScrolling() {
+  return _scrolling;
+}
 
 uint8_t Implementation::reset() {
   if (!interface->hwReset()) return 0;
+  // Everything is back at the power on defaults.
+  invalidate();
   return clear();
 }
 
-// TODO: Reset everything, then set it again?
 uint8_t Implementation::init() {
+  return init(&defaultInitSequence);
+}
+
+uint8_t Implementation::init(const InitSequence* sequence) {
   uint8_t error = 0;
+  // The state of the display is unknown, send everything.
+  invalidate();
+  // The sequence sets the remapping.
+  _rotation = 0;
+  _columnOffset = 0;
   error |= reset();
-  // In case the display is in locked mode, unlock it.
-  error |= mcuProtectDisable();
-  // Turn it off for now.
-  error |= setDisplayOff();
-  // Only set necessary com to segment remapping (com split).
-  error |= resetRemapping();
-  // Start rendering on line 1.
-  error |= setStartLine((uint8_t) Default::StartLine);
-  // Set rendering offset to 0.
-  error |= setDisplayOffset((uint8_t) Default::DisplayOffset);
-  // Set MUX ration to amount of display lines.
-  error |= resetMuxRatio();
-  // Enable Vdd regulator
-  error |= enableVddRegulator(true);
-  // Set contrast to 50%.
-  error |= setContrastLevel((uint8_t) Default::ContrastLevel);
-  // Set current phase length value defaults to Default::PhaseLength.
-  error |= setPhaseLength(_phaseLen);
-  // Rendering range to begin to end of screen.
-  error |= resetRange();
-  // Set the clock frequency and frequency divider.
-  error |= setDisplayClock(
-    (uint8_t) Default::DisplayClockFrequency,
-    (uint8_t) Default::DisplayClockDivider
-  );
-  // Reset the gray scale colour map to the default.
-  error |= resetGrayscale();
-  // Set Pre-charge voltage of the OLED driver.
-  error |= setPreChargeVoltage((uint8_t) Default::PreChargeVoltage);
-  // Set com deselect voltage, for segments that should remain disabled.
-  error |= setComDeselectVoltage((uint8_t) Default::ComDeselectVoltage);
-  // Set second pre-charge period.
-  error |= setSecondPrechargePeriod((uint8_t) Default::SecondPrechargePeriod);
-  // Set current values for enabling/disabling second pre-charge and Vsl regulator.
-  error |= functionSelectionB(_functionSelB);
-  // Not inverse or all OLED on/off.
-  error |= setDisplayNormal();
-  // Switch it on!
-  error |= setDisplayOn();
+  // The whole configuration, including the settings that depend on the
+  // display size and switching it on, goes out in one transaction.
+  uint8_t buffer[InitSequence::Length + InitSequence::Tail];
+  loadInitSequence(buffer, sequence, _width, _height);
+  uint8_t sent = sendCommand(buffer, sizeof(buffer));
+  if (sent == 0) _cacheInit(buffer);
+  error |= sent;
   _waitms(100);
   return error;
 }
+
+/**
+ * Fill the register cache with what an init sequence set, so setting the
+ * same values afterwards is skipped.
+ */
+void Implementation::_cacheInit(const uint8_t* sequence) {
+  static const uint8_t registers[][2] = {
+    {(uint8_t)Register::McuProtect, InitSequence::McuProtect},
+    {(uint8_t)Register::Remapping, InitSequence::Remapping},
+    {(uint8_t)Register::StartLine, InitSequence::StartLine},
+    {(uint8_t)Register::DisplayOffset, InitSequence::DisplayOffset},
+    {(uint8_t)Register::VddRegulator, InitSequence::VddRegulator},
+    {(uint8_t)Register::ContrastLevel, InitSequence::ContrastLevel},
+    {(uint8_t)Register::PhaseLength, InitSequence::PhaseLength},
+    {(uint8_t)Register::DisplayClock, InitSequence::DisplayClock},
+    {(uint8_t)Register::PreChargeVoltage, InitSequence::PreChargeVoltage},
+    {(uint8_t)Register::ComDeselectVoltage, InitSequence::ComDeselectVoltage},
+    {
+      (uint8_t)Register::SecondPrechargePeriod,
+      InitSequence::SecondPrechargePeriod
+    },
+    {(uint8_t)Register::FunctionSelectionB, InitSequence::FunctionSelectionB},
+    {(uint8_t)Register::DisplayMode, InitSequence::DisplayMode},
+  };
+  for (uint8_t i = 0; i < sizeof(registers) / sizeof(registers[0]); i++) {
+    _cache((Register)registers[i][0], sequence[registers[i][1]]);
+  }
+  _phaseLen = sequence[InitSequence::PhaseLength];
+  _functionSelB = sequence[InitSequence::FunctionSelectionB] & 0b11;
+  const uint8_t* tail = sequence + InitSequence::Length;
+  _cache(Register::MuxRatio, tail[1]);
+  _cache(Register::ColumnStart, tail[3]);
+  _cache(Register::ColumnEnd, tail[4]);
+  _cache(Register::RowStart, tail[6]);
+  _cache(Register::RowEnd, tail[7]);
+  _columnAtStart = _rowAtStart = true;
+  _written = 0;
+  _writtenKnown = true;
+  _cache(Register::DisplayPower, (uint8_t)Cmd::DisplayOn);
+  // The sequence stops scrolling.
+  _invalidateScrollArea();
+  _scrolling = false;
+}
@@ -2,17 +2,31 @@
  * SSD1327 Grayscale driver library for SSD1327 over I2C.
  *
  */
-#ifndef SSD1327_MAX_I2C_BUFFER
-#define SSD1327_MAX_I2C_BUFFER 32
+#ifndef SSD1327_H
+#define SSD1327_H
+
+
+// Size of the controller's display memory, 2 pixels per column.
+#define SSD1327_GDDRAM_COLUMNS 64
+#define SSD1327_GDDRAM_ROWS 128
+
+// Size of stack buffers used to prepare pixel data before sending it.
+#ifndef SSD1327_DATA_BUFFER
+#define SSD1327_DATA_BUFFER 64
 #endif
-#ifndef SSD1327_MAX_SPI_BUFFER
-#define SSD1327_MAX_SPI_BUFFER 32
+// Bytes of commands that can be queued in a command batch.
+#ifndef SSD1327_COMMAND_QUEUE
+#define SSD1327_COMMAND_QUEUE 48
 #endif
 
 #include <stdint.h>
 
 namespace Ssd1327  {
 
+class FrameBuffer;
+class DmaInterface;
+struct InitSequence;
+
 class Interface {
   /**
    * Virtual methods to be implemented for writing data to the display over an.
@@ -62,6 +76,22 @@ class Interface {
    * @param len Amount of bytes to send.
    */
   virtual uint8_t sendData(uint8_t* data, uint16_t len)=0;
+  /**
+   * Start a burst, the sendData calls until endBurst belong together, e.g.
+   * the data for one address window sent in parts. Interfaces that can keep
+   * the transaction open for the whole burst, by default nothing happens.
+   */
+  virtual void beginBurst();
+  /**
+   * End a burst started with beginBurst.
+   * @return Status of the transmission, 0 for success.
+   */
+  virtual uint8_t endBurst();
+  /**
+   * The interface as a DmaInterface if it can send data asynchronously,
+   * nullptr by default.
+   */
+  virtual DmaInterface* getDma();
   enum class InterfaceType: uint8_t {
     Spi = 0,
     I2c = 1
@@ -69,6 +99,47 @@ class Interface {
   uint8_t type;
 };
 
+/**
+ * Interface that can send data without blocking the CPU, e.g. with DMA.
+ *
+ * sendDataAsync starts a transfer and returns right away, the implementation
+ * calls _complete when the transfer is done, from its interrupt or thread.
+ * Commands and blocking sendData calls wait for a running transfer first, the
+ * display can't take commands halfway a transfer.
+ */
+class DmaInterface: public Interface {
+  public:
+  /**
+   * Called when an asynchronous transfer completed.
+   * @param context as passed to setCallback.
+   * @param status of the transfer, 0 for success.
+   */
+  typedef void (*Callback)(void* context, uint8_t status);
+  DmaInterface* getDma();
+  /**
+   * Start sending data and return, the data must stay as it is until the
+   * transfer completed.
+   * @return 0 if the transfer started.
+   */
+  virtual uint8_t sendDataAsync(uint8_t* data, uint16_t len)=0;
+  /**
+   * Whether an asynchronous transfer is running.
+   */
+  virtual bool isBusy()=0;
+  /**
+   * Set the function called when an asynchronous transfer completed, nullptr
+   * for none. Not called for blocking sendData calls.
+   */
+  void setCallback(Callback callback, void* context);
+
+  protected:
+  void _complete(uint8_t status);
+
+  private:
+  Callback _callback = nullptr;
+  void* _context = nullptr;
+};
+
 class Implementation {
 
 public:
@@ -267,11 +338,16 @@ public:
      * columnStart E[5:0]: 0x00 - 0x3f (column 1 - 64)
      *
      * columnEnd   F[5:0]: 0x00 - 0x3f (column 1 - 64) > columnStart
+     * dummy       G[7:0]: mandatory empty byte.
+     * Scrolling must be deactivated before sending this command.
      */
     SetHorizontalScrollRight= 0x26,
     // Same as SetHorizontalScrollRight, except it scrolls left.
     SetHorizontalScrollLeft = 0x27,
+    // Start scrolling with the last parameters set, GDDRAM must not be
+    // written while scrolling.
     ActivateScroll          = 0x2f,
+    // Stop scrolling, GDDRAM contents of the scroll area have to be rewritten.
     DectivateScroll         = 0x2e
   };
 
@@ -287,7 +363,7 @@ public:
      McuProtectLockMask             = 0b00000100,
      ComSplitOddEvenOnMask          = 0b01000000,
      ComRemappingOnMask             = 0b00010000,
-     HorizontalAddressIncrementMask = 0b01000100,
+     VerticalAddressIncrementMask   = 0b00000100,
      NibbleRemappingOnMask          = 0b00000010,
      GddrRemappingOnMask            = 0b00000001,
      FunctionSelectionBBase         = 0b01100000,
@@ -326,18 +402,103 @@ public:
     Frames_256    = 0b011
   };
 
+  // Returned instead of a transmission status if arguments are not valid.
+  static const uint8_t ERROR_INVALID_ARGUMENT = 254;
+
   enum class GpioMode: uint8_t {
     InputDisable = 0b00,
     InputEnable  = 0b01,
     Output       = 0b10
   };
 
+  /**
+   * Controller registers kept in the shadow cache. Setting a register to the
+   * value it already holds is skipped. A range's end must directly follow its
+   * start.
+   */
+  enum class Register: uint8_t {
+    ColumnStart           = 0,
+    ColumnEnd             = 1,
+    RowStart              = 2,
+    RowEnd                = 3,
+    ContrastLevel         = 4,
+    Remapping             = 5,
+    StartLine             = 6,
+    DisplayOffset         = 7,
+    DisplayMode           = 8,
+    DisplayPower          = 9,
+    MuxRatio              = 10,
+    VddRegulator          = 11,
+    PhaseLength           = 12,
+    DisplayClock          = 13,
+    Gpio                  = 14,
+    SecondPrechargePeriod = 15,
+    PreChargeVoltage      = 16,
+    ComDeselectVoltage    = 17,
+    FunctionSelectionB    = 18,
+    McuProtect            = 19,
+    Count                 = 20
+  };
+
   /**
    * Create an instance of the OLED driver.
    *
    * @param Ssd1327::Interface OLED interface struct.
    */
   Implementation(uint8_t width, uint8_t height);
+  /**
+   * Start a command batch. Until the batch ends, commands are queued and sent
+   * as one command transaction instead of one transaction each. The queue is
+   * sent when it's full, before data is sent, on flushCommands and when the
+   * outermost batch ends, batches can be nested.
+   */
+  void beginCommandBatch();
+  /**
+   * End a command batch, sends the queued commands if it's the outermost.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t endCommandBatch();
+  /**
+   * Send all queued commands now.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t flushCommands();
+  /**
+   * Forget the cached controller registers, the next setting of every
+   * register is sent. Call it when the display state is unknown, e.g. after
+   * a reset the library didn't do or after sending commands directly with
+   * sendCommand or through the interface.
+   */
+  void invalidate();
+  /**
+   * Send a command (including its arguments), queued if a batch is active.
+   * Bypasses the register cache.
+   */
+  uint8_t sendCommand(uint8_t command);
+  uint8_t sendCommand(uint8_t* command, uint8_t len);
+  /**
+   * Send data to the display, queued commands are sent first.
+   */
+  uint8_t sendData(uint8_t* data, uint16_t len);
+  /**
+   * Start sending data without waiting for it, see DmaInterface. Queued
+   * commands are sent first.
+   * @return 0 if the transfer started, ERROR_INVALID_ARGUMENT if the interface
+   *         isn't a DmaInterface.
+   */
+  uint8_t sendDataAsync(uint8_t* data, uint16_t len);
+  /**
+   * Keep a copy of what the display shows in a frame buffer of the same size.
+   *
+   * A segment holds 2 pixels and can only be written as a whole, so images
+   * that start or end halfway a segment need the pixel next to them. With a
+   * shadow buffer renderImageData takes that pixel from the shadow, without it
+   * it's set to 0 (black). Every image rendered is copied into the shadow.
+   *
+   * @param shadow frame buffer, nullptr to stop shadowing.
+   */
+  void setShadowBuffer(FrameBuffer* shadow);
+  FrameBuffer* getShadowBuffer();
   uint8_t setColumnRange(uint8_t start, uint8_t end);
   uint8_t setRowRange(uint8_t start, uint8_t end);
   uint8_t resetRange();
@@ -353,11 +514,36 @@ public:
   uint8_t setRemapping(
     bool comSplitOddEven,
     bool comRemapping,
-    bool horizontalAddressIncrement,
+    bool verticalAddressIncrement,
     bool nibbleRemapping,
     bool gddrRemapping
   );
   uint8_t resetRemapping();
+  /**
+   * Rotate the image on the panel clockwise, by 0, 90, 180 or 270 degrees.
+   *
+   * 180 degrees costs nothing: the controller scans the COM lines the other
+   * way, counts column addresses down and swaps the nibbles of every byte, so
+   * everything keeps drawing in rotated coordinates. At 90 and 270 degrees
+   * display lines become panel columns, which the controller can't do.
+   * Draw in a FrameBuffer of getHeight() x getWidth() pixels, flush
+   * transposes it (270 is 90 plus the free 180). The drawing methods of this
+   * class and vertical scrolling stay in panel coordinates then, horizontal
+   * scrolling is refused.
+   *
+   * Replaces the remapping of the init sequence, init() sets the rotation
+   * back to 0.
+   *
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT for other angles.
+   */
+  uint8_t setRotation(uint16_t degrees);
+  uint16_t getRotation();
+  /**
+   * Fill the address window top to bottom, then the next column, instead of
+   * line by line. Keeps the rotation, see FrameBuffer::flush.
+   */
+  uint8_t setVerticalAddressIncrement(bool vertical);
   uint8_t setStartLine(uint8_t line);
 
   uint8_t setMuxRatio(uint8_t ratio);
@@ -403,27 +589,179 @@ public:
   uint8_t enableVslRegulator(bool state);
   uint8_t mcuProtectEnable();
   uint8_t mcuProtectDisable();
-  // uint8_t setHorizontalScrollRight();
-  // uint8_t setHorizontalScrollLeft();
-  // uint8_t activateScroll();
-  // uint8_t dectivateScroll();
+  /**
+   * Set up hardware scrolling of an area to the right, every step moves the
+   * area one column (2 pixels) and wraps around. Stops scrolling if it was
+   * active, call activateScroll to start.
+   *
+   * @param columnStart first column (segment) of the area, 0x00 - 0x3f.
+   * @param columnEnd last column, >= columnStart.
+   * @param rowStart first row of the area, 0x00 - 0x7f.
+   * @param rowEnd last row, >= rowStart.
+   * @param speed frames between steps.
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT if the area is empty or the display is
+   *         rotated by 90 or 270 degrees.
+   *
+   * Rotated by 180 degrees the columns are offset like those of
+   * setColumnRange, so the area is where the same columns are drawn. Set
+   * the area up again after changing the rotation.
+   */
+  uint8_t setHorizontalScrollRight(
+    uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart, uint8_t rowEnd,
+    ScrollSpeed speed
+  );
+  // Same as setHorizontalScrollRight, except it scrolls left.
+  uint8_t setHorizontalScrollLeft(
+    uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart, uint8_t rowEnd,
+    ScrollSpeed speed
+  );
+  /**
+   * Start scrolling. The controller moves the pixels on its own, nothing is
+   * sent until deactivateScroll. Don't render anything while scrolling.
+   */
+  uint8_t activateScroll();
+  /**
+   * Stop scrolling. The scrolled area is left at an unknown position, it's
+   * invalidated in the shadow buffer so the next flush of the shadow buffer
+   * restores it.
+   */
+  uint8_t deactivateScroll();
+  bool isScrolling();
+  /**
+   * Scroll the display vertically by moving the start line, GDDRAM is used as
+   * a ring buffer of SSD1327_GDDRAM_ROWS rows. Only the start line command
+   * and the newly exposed lines are sent. renderImageData and fillRect take
+   * the start line into account, so they keep drawing in display lines.
+   *
+   * @param lines to scroll, positive moves the contents up and exposes lines
+   *        at the bottom, negative moves it down and exposes lines at the top.
+   * @param level to fill the exposed lines with, negative to leave them as
+   *        they are, e.g. if they are drawn over right away.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t scrollVertically(int8_t lines, int8_t level = 0);
+  /**
+   * Clear the screen, same as filling it with level 0.
+   */
   uint8_t clear();
+  /**
+   * Fill a rectangle on the display with one grayscale level, clipped to the
+   * display. The window is set once and the level is streamed from a small
+   * stack buffer. Like renderImageData, segments that are only partially
+   * covered take the other pixel from the shadow buffer, or 0 without one.
+   *
+   * @param level 0x0 - 0xf.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t fillRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  );
+  /**
+   * Reset and configure the display with the defaults, see InitConfig.
+   */
   uint8_t init();
+  /**
+   * Reset and configure the display with a sequence built by
+   * `InitConfig::build`, in one command transaction.
+   *
+   * @param sequence in flash (SSD1327_PROGMEM).
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t init(const InitSequence* sequence);
   uint8_t getHeight();
   uint8_t getWidth();
+  /**
+   * Render packed image data (2 pixels per byte, lines are not padded) at any
+   * x, y coordinate. See setShadowBuffer for images that don't start and end
+   * on a segment boundary. y is a display line, it's translated to a GDDRAM
+   * row using the start line (see scrollVertically).
+   *
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT if len is too short for the dimensions.
+   */
   uint8_t renderImageData(
     uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t *image,
     uint16_t len
   );
+  /**
+   * Render a run length encoded image (see RleDecoder), like
+   * renderImageData. The image is decoded as it's sent, whole lines at a
+   * time into a stack buffer of SSD1327_RLE_BUFFER bytes. Images at an even x
+   * with an even width are sent in one address window.
+   *
+   * @param len of the compressed data.
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT if the data ends before the image does.
+   */
+  uint8_t renderCompressedImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *data,
+    uint32_t len
+  );
   uint8_t reset();
   Interface* interface;
 
 private:
   uint8_t _width;
   uint8_t _height;
+  uint16_t _rotation = 0;
+  // Added to column addresses when they count down from the last GDDRAM
+  // column (rotated by 180 or 270 degrees), so narrow panels still show the
+  // first columns.
+  uint8_t _columnOffset = 0;
   uint8_t _phaseLen     = (uint8_t) Default::PhaseLength;
   uint8_t _functionSelB = (uint8_t) Default::FunctionSelectionB;
   GpioMode _gpioMode;
+  uint8_t _commandQueue[SSD1327_COMMAND_QUEUE];
+  uint8_t _queued = 0;
+  uint8_t _batchDepth = 0;
+  // Shadow copy of the controller registers, one valid bit per register.
+  uint8_t _shadow[(uint8_t)Register::Count];
+  uint32_t _shadowValid = 0;
+  // Bytes written into the current address window, modulo its size, if
+  // known, and whether the address pointer is at the start of the column and
+  // row range.
+  uint16_t _written = 0;
+  bool _writtenKnown = false;
+  bool _columnAtStart = false;
+  bool _rowAtStart = false;
+  FrameBuffer* _shadowBuffer = nullptr;
+  // Scroll area as sent with the last scroll setup, in columns and rows.
+  uint8_t _scrollArea[4];
+  bool _scrollSet = false;
+  bool _scrolling = false;
+
+  bool _isCached(Register reg, uint8_t value);
+  void _cache(Register reg, uint8_t value);
+  void _uncache(Register reg);
+  uint8_t _setRegister(Register reg, Cmd command, uint8_t value);
+  uint8_t _setRegister(Register reg, Cmd command);
+  uint8_t _setWindow(
+    Register startReg, Cmd command, uint8_t start, uint8_t end
+  );
+  void _invalidateWindow();
+  uint16_t _windowSize();
+  void _advanceWindow(uint16_t len);
+  uint8_t _setHorizontalScroll(
+    Cmd command, uint8_t columnStart, uint8_t columnEnd, uint8_t rowStart,
+    uint8_t rowEnd, ScrollSpeed speed
+  );
+  void _invalidateScrollArea();
+  void _cacheInit(const uint8_t* sequence);
+  bool _isKnown(Register reg);
+  uint8_t _knowStartLine();
+  uint8_t _lineToRow(uint8_t line);
+  uint8_t _fillRows(
+    uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t level
+  );
+  uint8_t _renderRows(
+    uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t *image,
+    uint32_t offset
+  );
+  uint8_t _sendRealigned(
+    uint8_t x, uint8_t row, uint8_t width, uint8_t height, uint8_t *image,
+    uint32_t offset
+  );
 
 
   /**
@@ -435,3 +773,4 @@ private:
   virtual void _waitms(uint16_t ms)=0;
 };
 };
+#endif
@@ -0,0 +1,126 @@
+#include "ssd1327Animation.h"
+
+using namespace Ssd1327;
+
+// Sizes of the container header, a frame record header and a rectangle
+// header.
+#define ANIMATION_HEADER 4
+#define FRAME_HEADER 3
+#define RECT_HEADER 6
+
+AnimationPlayer::AnimationPlayer(
+  Implementation* display, const uint8_t* data, uint32_t len
+): _display(display), _data(data), _end(data + len) {
+  if (len < ANIMATION_HEADER || getFrameCount() == 0) return;
+  // Check every record up front, playing never reads past the end.
+  const uint8_t* frame = _data + ANIMATION_HEADER;
+  for (uint32_t i = 0; i <= getFrameCount() && frame != nullptr; i++) {
+    frame = _skipFrame(frame);
+    if (i == 0) _firstDelta = frame;
+  }
+  _valid = frame != nullptr;
+  rewind();
+}
+
+bool AnimationPlayer::isValid() {
+  return _valid;
+}
+
+uint8_t AnimationPlayer::getWidth() {
+  return _end - _data < ANIMATION_HEADER ? 0 : _data[0];
+}
+
+uint8_t AnimationPlayer::getHeight() {
+  return _end - _data < ANIMATION_HEADER ? 0 : _data[1];
+}
+
+uint16_t AnimationPlayer::getFrameCount() {
+  return _end - _data < ANIMATION_HEADER ? 0 : _read16(_data + 2);
+}
+
+void AnimationPlayer::setPosition(uint8_t x, uint8_t y) {
+  _x = x;
+  _y = y;
+}
+
+void AnimationPlayer::setFrameRate(uint8_t fps) {
+  _interval = fps > 0 ? 1000 / fps : 0;
+}
+
+void AnimationPlayer::setLoop(bool loop) {
+  _loop = loop;
+}
+
+bool AnimationPlayer::isFinished() {
+  return !_loop && _shown == getFrameCount() - 1;
+}
+
+void AnimationPlayer::rewind() {
+  _shown = -1;
+  _next = _data + ANIMATION_HEADER;
+}
+
+uint8_t AnimationPlayer::nextFrame() {
+  if (!_valid) return Implementation::ERROR_INVALID_ARGUMENT;
+  if (isFinished()) return 0;
+  uint8_t error = _sendFrame(_next);
+  // After the last frame comes the delta back to the first, after that the
+  // delta to the second frame.
+  const uint8_t* next = _skipFrame(_next);
+  _shown = _shown == getFrameCount() - 1 ? 0 : _shown + 1;
+  _next = _shown == 0 ? _firstDelta : next;
+  return error;
+}
+
+uint8_t AnimationPlayer::update(uint32_t now) {
+  if (!_valid || isFinished()) return 0;
+  bool first = _shown < 0;
+  if (!first && (int32_t)(now - _due) < 0) return 0;
+  uint8_t error = nextFrame();
+  uint16_t delay = _interval > 0 ? _interval : _delay;
+  _due = first ? now + delay : _due + delay;
+  // More than a frame behind, catching up would rush the next frames.
+  if ((int32_t)(now - _due) >= 0) _due = now + delay;
+  return error;
+}
+
+uint16_t AnimationPlayer::_read16(const uint8_t* data) {
+  return data[0] | data[1] << 8;
+}
+
+/**
+ * Find the record after a frame record.
+ * @return nullptr if the record runs past the end of the data.
+ */
+const uint8_t* AnimationPlayer::_skipFrame(const uint8_t* frame) {
+  if (_end - frame < FRAME_HEADER) return nullptr;
+  uint8_t rects = frame[2];
+  frame += FRAME_HEADER;
+  for (uint8_t i = 0; i < rects; i++) {
+    if (_end - frame < RECT_HEADER) return nullptr;
+    uint16_t len = _read16(frame + 4);
+    frame += RECT_HEADER;
+    if (_end - frame < len) return nullptr;
+    frame += len;
+  }
+  return frame;
+}
+
+/**
+ * Send the rectangles of a frame record, one window each.
+ */
+uint8_t AnimationPlayer::_sendFrame(const uint8_t* frame) {
+  _delay = _read16(frame);
+  uint8_t rects = frame[2];
+  frame += FRAME_HEADER;
+  uint8_t error = 0;
+  for (uint8_t i = 0; i < rects && error == 0; i++) {
+    uint16_t len = _read16(frame + 4);
+    error = _display->renderCompressedImage(
+      _x + frame[0], _y + frame[1], frame[2], frame[3], frame + RECT_HEADER,
+      len
+    );
+    frame += RECT_HEADER + len;
+  }
+  return error;
+}
@@ -0,0 +1,109 @@
+/*
+ * Delta encoded animations for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_ANIMATION_H
+#define SSD1327_ANIMATION_H
+
+#include <stdint.h>
+#include "ssd1327.h"
+
+namespace Ssd1327 {
+
+/**
+ * Plays animations written by `bin/convertimage --animation`.
+ *
+ * Only the first frame is stored whole, every other frame is a list of
+ * rectangles that changed since the frame before it. A spinner or a progress
+ * bar sends a small part of the screen per frame instead of a full frame.
+ * Every rectangle is run length encoded (see RleDecoder) and sent with
+ * `Implementation::renderCompressedImage`, in one address window.
+ *
+ * Container, numbers are little endian:
+ *
+ *     width, height               uint8_t each, pixels.
+ *     frames                      uint16_t, number of frames.
+ *     frames + 1 frame records:   the first frame, the deltas to frames 1 -
+ *                                 frames - 1 and the delta from the last
+ *                                 frame back to the first for looping.
+ *
+ *     frame record:
+ *       delay                     uint16_t, ms to show the frame.
+ *       rectangles                uint8_t.
+ *       per rectangle:
+ *         x, y, width, height     uint8_t each, pixels, x and width even.
+ *         length                  uint16_t, bytes of run length encoded
+ *                                 pixels that follow.
+ */
+class AnimationPlayer {
+public:
+  /**
+   * @param display to play on.
+   * @param data of the animation, checked right away, see isValid.
+   * @param len of data in bytes.
+   */
+  AnimationPlayer(Implementation* display, const uint8_t* data, uint32_t len);
+
+  bool isValid();
+  uint8_t getWidth();
+  uint8_t getHeight();
+  uint16_t getFrameCount();
+  /**
+   * Set the position of the top left of the animation on the display. An
+   * uneven x works but needs a shadow buffer, see renderImageData.
+   */
+  void setPosition(uint8_t x, uint8_t y);
+  /**
+   * Play at a fixed rate instead of the frame delays of the animation.
+   * @param fps frames per second, 0 to use the delays of the animation.
+   */
+  void setFrameRate(uint8_t fps);
+  void setLoop(bool loop);
+  /**
+   * Send the next frame right away.
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT if the animation isn't valid.
+   */
+  uint8_t nextFrame();
+  /**
+   * Send the next frame if it's due, call it often, e.g. from loop().
+   * Frames are due at fixed intervals, a frame sent late doesn't delay the
+   * ones after it. Frames are never skipped, every delta builds on the frame
+   * before it. When the bus can't keep up the animation slows down.
+   *
+   * @param now time in ms, e.g. millis().
+   * @return Status of the transmission, 0 for success or nothing due.
+   */
+  uint8_t update(uint32_t now);
+  /**
+   * Whether the last frame is shown, never when looping.
+   */
+  bool isFinished();
+  /**
+   * Start over, the next frame is the first frame, sent whole.
+   */
+  void rewind();
+
+private:
+  Implementation* _display;
+  const uint8_t* _data;
+  const uint8_t* _end;
+  const uint8_t* _firstDelta = nullptr;
+  bool _valid = false;
+  uint8_t _x = 0;
+  uint8_t _y = 0;
+  bool _loop = true;
+  uint16_t _interval = 0;
+  // Frame on the display (-1 for none), the record of the next frame and
+  // when it's due.
+  int32_t _shown = -1;
+  const uint8_t* _next = nullptr;
+  uint16_t _delay = 0;
+  uint32_t _due = 0;
+
+  static uint16_t _read16(const uint8_t* data);
+  const uint8_t* _skipFrame(const uint8_t* frame);
+  uint8_t _sendFrame(const uint8_t* frame);
+};
+};
+#endif
@@ -1,46 +1,51 @@
 #include "ssd1327Arduino.h"
 #include <Arduino.h>
+#include <string.h>
 
 namespace Ssd1327 {
 
-uint8_t ArduinoI2cInterface::sendCommand(uint8_t *command, uint8_t len)
+/**
+ * Send bytes with block writes, in as few transactions as the Wire buffer
+ * allows. Every transaction starts with the control byte, so a transaction
+ * that is split in 2 still has the right meaning to the display.
+ */
+uint8_t ArduinoI2cInterface::_send(
+  uint8_t control, uint8_t *bytes, uint16_t len
+)
 {
-  _i2c->beginTransmission(_address);
-  _i2c->write(0x00); // Control byte 0x00 specifies commands.
-  while(len--)
+  // Payload per transaction, the control byte takes one byte of the buffer.
+  const uint16_t chunk = SSD1327_MAX_I2C_BUFFER - 1;
+  uint8_t error = 0;
+  while (len > 0)
   {
-    _i2c->write(*command++);
+    uint16_t n = len > chunk ? chunk : len;
+    // Don't leave a single byte for the last transaction, split the last 2
+    // chunks evenly instead.
+    if (len > chunk && len - chunk < 2) n = len / 2;
+    _i2c->beginTransmission(_address);
+    _i2c->write(control);
+    _i2c->write(bytes, n);
+    error = _i2c->endTransmission(true);
+    if (error != 0) return error;
+    bytes += n;
+    len -= n;
   }
-  return _i2c->endTransmission(true);
+  return error;
+}
+
+uint8_t ArduinoI2cInterface::sendCommand(uint8_t *command, uint8_t len)
+{
+  return _send(0x00, command, len); // Control byte 0x00 specifies commands.
 }
 
 uint8_t ArduinoI2cInterface::sendCommand(uint8_t command)
 {
-  _i2c->beginTransmission(_address);
-  _i2c->write(0x00); // Control byte 0x00 specifies commands.
-  _i2c->write((uint8_t)command);
-  return _i2c->endTransmission(true);
+  return _send(0x00, &command, 1);
 }
 
 uint8_t ArduinoI2cInterface::sendData(uint8_t *data, uint16_t len)
 {
-  _i2c->beginTransmission(_address);
-  _i2c->write(0x40); // Control byte 0x40 specifies data.
-  uint8_t error = 0;
-  // Send data in chunks that fit in the display module I2C buffer.
-  while (len--)
-  {
-    // Reset connection for every buffer length minus address and control byte
-    if (len % (SSD1327_MAX_I2C_BUFFER - 2) == 0)
-    {
-      error = _i2c->endTransmission(true);
-      if (error !=0) return error;
-      _i2c->beginTransmission(_address);
-      _i2c->write(0x40);
-    }
-    _i2c->write(*data++);
-  }
-  return _i2c->endTransmission(true);
+  return _send(0x40, data, len); // Control byte 0x40 specifies data.
 }
 
 void ArduinoI2cInterface::beginTransmission()
@@ -57,17 +62,25 @@ void ArduinoI2cInterface::write(uint8_t byte)
 }
 
 ArduinoI2cInterface::ArduinoI2cInterface(
-  TwoWire* i2c, uint8_t i2cAddress
-) {
+  TwoWire* i2c, uint8_t i2cAddress, uint32_t frequency
+): _frequency(frequency), _i2c(i2c), _address(i2cAddress)
+{
   type = (uint8_t)Interface::InterfaceType::I2c;
 }
+ArduinoI2cInterface::ArduinoI2cInterface(
+  TwoWire* i2c, uint8_t i2cAddress
+): ArduinoI2cInterface(i2c, i2cAddress, 0)
+{}
 void ArduinoI2cInterface::begin()
 {
   _i2c->begin();
+  if (_frequency > 0) _i2c->setClock(_frequency);
 }
 uint8_t ArduinoSpiInterface::sendCommand(uint8_t *command, uint8_t len)
 {
-  beginTransmission();
+  // During a burst CS# is already low, D/C# is sampled per byte so commands
+  // can be sent in between data.
+  if (!_burst) beginTransmission();
   if (_dc > Interface::NO_PIN)
   {
     // Serial.println("CMD: Setting D/C# low.");
@@ -77,36 +90,28 @@ uint8_t ArduinoSpiInterface::sendCommand(uint8_t *command, uint8_t len)
   // {
   //   Serial.printf("CMD: 0x%02x\n", command[i]);
   // }
-  _spi.transfer(command, len);
+  _transfer(command, len);
   
   if (_dc > Interface::NO_PIN)
   {
     // Serial.println("CMD: Setting D/C# high.");
     digitalWrite(_dc, HIGH);
   }
-  return endTransmission();
+  return _burst ? 0 : endTransmission();
 }
 
 uint8_t ArduinoSpiInterface::sendCommand(uint8_t command)
 {
-  beginTransmission();
-  if (_dc > Interface::NO_PIN)
-  {
-    // Serial.println("CMD: Setting D/C# low.");
-    digitalWrite(_dc, LOW);
-  }
-  // Serial.printf("CMD: 0x%02x\n", command);
-  _spi.transfer(command);
-  if (_dc > Interface::NO_PIN)
-  {
-    // Serial.println("CMD: Setting D/C# high.");
-    digitalWrite(_dc, HIGH);
-  }
-  return endTransmission();
+  return sendCommand(&command, 1);
 }
 
 uint8_t ArduinoSpiInterface::sendData(uint8_t *data, uint16_t len)
 {
+  if (_burst)
+  {
+    _transfer(data, len);
+    return 0;
+  }
   if (_dc > Interface::NO_PIN)
   {
     // Serial.println("DATA: Setting D/C# high.");
@@ -117,20 +122,52 @@ uint8_t ArduinoSpiInterface::sendData(uint8_t *data, uint16_t len)
   // {
   //   // Serial.printf("DATA: 0x%02x\n", data[i]);
   // }
-  // Send data in chunks that fit in the display module SPI buffer.
-  while (len--)
+  // The controller has no limit on the length of a transfer, keep CS# low
+  // for all of it.
+  _transfer(data, len);
+  return endTransmission();
+}
+
+void ArduinoSpiInterface::beginBurst()
+{
+  if (_burst) return;
+  if (_dc > Interface::NO_PIN)
   {
-    // Reset connection for every buffer length
-    if (len % SSD1327_MAX_SPI_BUFFER == 0)
-    {
-      endTransmission();
-      beginTransmission();
-    }
-    _spi.transfer(*data++);
+    digitalWrite(_dc, HIGH);
   }
+  beginTransmission();
+  _burst = true;
+}
+
+uint8_t ArduinoSpiInterface::endBurst()
+{
+  if (!_burst) return 0;
+  _burst = false;
   return endTransmission();
 }
 
+/**
+ * Buffer transfers overwrite the buffer with the received bytes on most
+ * platforms, so send from a copy unless the platform can write without
+ * receiving. Copying is much faster than sending byte by byte.
+ */
+void ArduinoSpiInterface::_transfer(uint8_t *data, uint16_t len)
+{
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+  _spi.writeBytes(data, len);
+#else
+  uint8_t chunk[SSD1327_SPI_CHUNK];
+  while (len > 0)
+  {
+    uint16_t n = len > SSD1327_SPI_CHUNK ? SSD1327_SPI_CHUNK : len;
+    memcpy(chunk, data, n);
+    _spi.transfer(chunk, n);
+    data += n;
+    len -= n;
+  }
+#endif
+}
+
 void ArduinoSpiInterface::beginTransmission() {
   if (_cs > Interface::NO_PIN)
   {
@@ -152,7 +189,7 @@ uint8_t ArduinoSpiInterface::endTransmission()
   return 0;
 }
 
-bool ArduinoSpiInterface::hWreset()
+bool ArduinoSpiInterface::hwReset()
 {
   if (_rst == Interface::NO_PIN) return false;
   // Serial.println("Hardware reset!");
@@ -252,12 +289,20 @@ ArduinoImplementation::ArduinoImplementation(
 {}
 
 ArduinoImplementation::ArduinoImplementation(
-  uint8_t width, uint8_t height, TwoWire* i2c, uint8_t i2cAddress
+  uint8_t width,
+  uint8_t height,
+  TwoWire* i2c,
+  uint8_t i2cAddress,
+  uint32_t i2cFrequency
 ):
   Implementation(width, height)
 {
-  interface = new ArduinoI2cInterface(i2c, i2cAddress);
+  interface = new ArduinoI2cInterface(i2c, i2cAddress, i2cFrequency);
 }
+ArduinoImplementation::ArduinoImplementation(
+  uint8_t width, uint8_t height, TwoWire* i2c, uint8_t i2cAddress
+): ArduinoImplementation(width, height, i2c, i2cAddress, 0)
+{}
 // This needs to be implemented to reclaim memory if the display object is
 // deleted.
 // ArduinoImplementation::~ArduinoImplementation() {
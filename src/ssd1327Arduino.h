@@ -1,3 +1,6 @@
+#ifndef SSD1327_ARDUINO_H
+#define SSD1327_ARDUINO_H
+
 #include "ssd1327.h"
 #include <Wire.h>
 #include <SPI.h>
@@ -6,9 +9,41 @@
 #define DEFAULT_SPI_SPEED 4000000L
 #endif
 
+// Bytes per SPI buffer transfer on platforms that can't transfer without
+// overwriting the data.
+#ifndef SSD1327_SPI_CHUNK
+#define SSD1327_SPI_CHUNK 64
+#endif
+
+#define SSD1327_I2C_FAST_MODE      400000L
+// The SSD1327 supports Fast-mode Plus, if the MCU and pull ups do too.
+#define SSD1327_I2C_FAST_MODE_PLUS 1000000L
+
+/**
+ * Size of the Wire transmit buffer. A transaction (control byte + payload)
+ * can't be any larger, data is sent in chunks of this size minus 1.
+ */
+#ifndef SSD1327_MAX_I2C_BUFFER
+#if defined(ARDUINO_ARCH_STM32)
+// Grows its buffer on demand.
+#define SSD1327_MAX_I2C_BUFFER 256
+#elif defined(I2C_BUFFER_LENGTH)
+// ESP32
+#define SSD1327_MAX_I2C_BUFFER I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+// AVR, ESP8266 and most other cores.
+#define SSD1327_MAX_I2C_BUFFER BUFFER_LENGTH
+#else
+#define SSD1327_MAX_I2C_BUFFER 32
+#endif
+#endif
+
 namespace Ssd1327 {
 
 class ArduinoI2cInterface: public Interface {
+  private:
+    uint32_t _frequency;
+    uint8_t _send(uint8_t control, uint8_t* bytes, uint16_t len);
   public:
     TwoWire* _i2c;
     uint8_t _address;
@@ -18,6 +53,13 @@ class ArduinoI2cInterface: public Interface {
     uint8_t sendCommand(uint8_t command);
     uint8_t sendCommand(uint8_t* command, uint8_t len);
     uint8_t sendData(uint8_t* data, uint16_t len);
+    /**
+     * @param i2c Wire instance the display is connected to.
+     * @param i2cAddress of the display.
+     * @param frequency of the I2C clock set on begin, e.g.
+     *        SSD1327_I2C_FAST_MODE_PLUS, 0 leaves the clock as it is.
+     */
+    ArduinoI2cInterface(TwoWire* i2c, uint8_t i2cAddress, uint32_t frequency);
     ArduinoI2cInterface(TwoWire* i2c, uint8_t i2cAddress);
     void begin();
 };
@@ -29,6 +71,8 @@ class ArduinoSpiInterface: public Interface {
     int8_t _cs;
     int8_t _rst;
     SPISettings _spiSettings;
+    bool _burst = false;
+    void _transfer(uint8_t* data, uint16_t len);
   public:
     void beginTransmission();
     uint8_t endTransmission();
@@ -36,7 +80,13 @@ class ArduinoSpiInterface: public Interface {
     uint8_t sendCommand(uint8_t command);
     uint8_t sendCommand(uint8_t* command, uint8_t len);
     uint8_t sendData(uint8_t* data, uint16_t len);
-    bool hWreset();
+    /**
+     * Keep CS# low from beginBurst to endBurst, so a window sent in several
+     * sendData calls is one SPI transaction.
+     */
+    void beginBurst();
+    uint8_t endBurst();
+    bool hwReset();
     ArduinoSpiInterface(
       SPIClass spi,
       int8_t dc,
@@ -54,6 +104,13 @@ class ArduinoImplementation: public Implementation {
     ArduinoImplementation(
       uint8_t width, uint8_t height, TwoWire* i2c, uint8_t i2cAddress
     );
+    ArduinoImplementation(
+      uint8_t width,
+      uint8_t height,
+      TwoWire* i2c,
+      uint8_t i2cAddress,
+      uint32_t i2cFrequency
+    );
     ArduinoImplementation(
       uint8_t width,
       uint8_t height,
@@ -87,3 +144,4 @@ class ArduinoImplementation: public Implementation {
     uint8_t begin();
 };
 }
+#endif
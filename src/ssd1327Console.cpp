@@ -0,0 +1,201 @@
+#include "ssd1327Console.h"
+#include "ssd1327Nibbles.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TAB_WIDTH 8
+
+using namespace Ssd1327;
+
+Console::Console(
+  Implementation* display, const Font* font, uint8_t lineHeight
+): _display(display), _font(font)
+{
+  _lineHeight = lineHeight > font->height ? lineHeight : font->height;
+  _columns = display->getWidth() / font->width;
+  _rows = display->getHeight() / _lineHeight;
+  // The last line is sent together with the lines below it.
+  uint8_t bottom = display->getHeight() - _rows * _lineHeight;
+  _text = (char*)malloc(_columns);
+  _pixels = (uint8_t*)malloc(
+    ((uint16_t)display->getWidth() * (_lineHeight + bottom) + 1) / 2
+  );
+  if (_text == nullptr || _pixels == nullptr) {
+    free(_text);
+    free(_pixels);
+    _text = nullptr;
+    _pixels = nullptr;
+    _columns = 0;
+    _rows = 0;
+  } else {
+    memset(_text, ' ', _columns);
+  }
+  setColors(0x0f, 0x00);
+}
+
+Console::~Console() {
+  free(_text);
+  free(_pixels);
+}
+
+void Console::setColors(uint8_t foreground, uint8_t background) {
+  foreground &= 0x0f;
+  background &= 0x0f;
+  _background = background;
+  for (uint8_t i = 0; i < 16; i++) {
+    int16_t blend = ((int16_t)foreground - background) * i;
+    // Round to the nearest level, both ways.
+    blend = blend < 0 ? (blend - 7) / 15 : (blend + 7) / 15;
+    _levels[i] = background + blend;
+  }
+}
+
+bool Console::isValid() {
+  return _text != nullptr;
+}
+
+uint8_t Console::clear() {
+  if (!isValid()) return Implementation::ERROR_INVALID_ARGUMENT;
+  _column = 0;
+  _row = 0;
+  _dirtyX0 = _dirtyX1 = 0;
+  _dirtyBottom = false;
+  memset(_text, ' ', _columns);
+  return _display->fillRect(
+    0, 0, _display->getWidth(), _display->getHeight(), _background
+  );
+}
+
+uint8_t Console::write(char c) {
+  if (!isValid()) return Implementation::ERROR_INVALID_ARGUMENT;
+  uint8_t error = 0;
+  if (c == '\n') return _newLine();
+  if (c == '\r') {
+    _column = 0;
+    return 0;
+  }
+  if (c == '\t') {
+    do {
+      error |= write(' ');
+    } while (_column % TAB_WIDTH != 0 && _column < _columns);
+    return error;
+  }
+  // Wrap when the next character is written, so a full line followed by a
+  // new line doesn't leave an empty line.
+  if (_column >= _columns) error |= _newLine();
+  _text[_column] = c;
+  _markDirty(_column * _font->width, (_column + 1) * _font->width);
+  _column++;
+  return error;
+}
+
+uint8_t Console::print(const char* text) {
+  uint8_t error = 0;
+  while (*text) {
+    error |= write(*text++);
+  }
+  return error | flush();
+}
+
+uint8_t Console::printf(const char* format, ...) {
+  char buffer[SSD1327_CONSOLE_BUFFER];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  return print(buffer);
+}
+
+uint8_t Console::getColumns() {
+  return _columns;
+}
+
+uint8_t Console::getRows() {
+  return _rows;
+}
+
+uint8_t Console::_newLine() {
+  uint8_t error = flush();
+  _column = 0;
+  memset(_text, ' ', _columns);
+  if (_row + 1 < _rows) {
+    _row++;
+    return error;
+  }
+  // Scroll a line, the exposed line is sent with the next flush instead of
+  // being cleared first: the whole width, including the lines below it.
+  error |= _display->scrollVertically(_lineHeight, -1);
+  _markDirty(0, _display->getWidth());
+  _dirtyBottom = true;
+  return error;
+}
+
+void Console::_markDirty(uint8_t x0, uint8_t x1) {
+  if (_dirtyX0 >= _dirtyX1) {
+    _dirtyX0 = x0;
+    _dirtyX1 = x1;
+    return;
+  }
+  if (x0 < _dirtyX0) _dirtyX0 = x0;
+  if (x1 > _dirtyX1) _dirtyX1 = x1;
+}
+
+// Glyph index of a character, that of '?' for characters missing in the font,
+// -1 if that's missing too.
+int16_t Console::_glyph(char c) {
+  uint8_t index = (uint8_t)c - _font->first;
+  if ((uint8_t)c < _font->first || index >= _font->count) {
+    index = '?' - _font->first;
+    if ('?' < _font->first || index >= _font->count) return -1;
+  }
+  return index;
+}
+
+/**
+ * Render the changed part of the line into the pixel buffer and send it. The
+ * part is widened to whole segments, the pixels next to it belong to the
+ * characters around it, which are known, so no shadow buffer is needed. A
+ * part that reaches the last column is widened to the edge of the display to
+ * clear the margin.
+ */
+uint8_t Console::flush() {
+  if (!isValid()) return Implementation::ERROR_INVALID_ARGUMENT;
+  if (_dirtyX0 >= _dirtyX1) return 0;
+  uint8_t width = _display->getWidth();
+  uint8_t fontWidth = _font->width;
+  uint8_t fontHeight = _font->height;
+  uint8_t x0 = _dirtyX0 & ~1;
+  uint8_t x1 = _dirtyX1;
+  if (x1 >= _columns * fontWidth) x1 = width;
+  if (x1 % 2 && x1 < width) x1++;
+  uint8_t w = x1 - x0;
+  uint8_t y = _row * _lineHeight;
+  uint8_t h = _dirtyBottom ? _display->getHeight() - y : _lineHeight;
+  uint32_t glyphSize = (uint32_t)fontWidth * fontHeight;
+  uint32_t dst = 0;
+  for (uint8_t row = 0; row < h; row++) {
+    uint8_t column = x0 / fontWidth;
+    uint8_t px = x0 % fontWidth;
+    int16_t glyph = column < _columns ? _glyph(_text[column]) : -1;
+    for (uint8_t i = 0; i < w; i++, dst++) {
+      uint8_t level = _background;
+      if (row < fontHeight && glyph >= 0) {
+        uint32_t src = glyph * glyphSize + (uint16_t)row * fontWidth + px;
+        level = _levels[Nibbles::get(_font->bits, src)];
+      }
+      Nibbles::set(_pixels, dst, level);
+      if (++px == fontWidth) {
+        px = 0;
+        column++;
+        glyph = column < _columns ? _glyph(_text[column]) : -1;
+      }
+    }
+  }
+  _dirtyX0 = _dirtyX1 = 0;
+  _dirtyBottom = false;
+  return _display->renderImageData(
+    x0, y, w, h, _pixels, ((uint32_t)w * h + 1) / 2
+  );
+}
@@ -0,0 +1,115 @@
+/*
+ * Text console for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_CONSOLE_H
+#define SSD1327_CONSOLE_H
+
+// Longest text printf formats at once, longer output is cut off.
+#ifndef SSD1327_CONSOLE_BUFFER
+#define SSD1327_CONSOLE_BUFFER 64
+#endif
+
+#include <stdint.h>
+#include "ssd1327.h"
+#include "ssd1327Font.h"
+
+namespace Ssd1327 {
+
+/**
+ * Scrolling text console with an anti aliased font.
+ *
+ * Text is written from the top line down, long lines wrap. Once the bottom
+ * line is full the display scrolls up by moving the start line
+ * (`Implementation::scrollVertically`), nothing is redrawn. Output is rendered
+ * per line: only the part of the current line that changed since the last
+ * flush is sent, a new line at the bottom costs the pixels of that line.
+ *
+ * Call clear before printing, the display contents are unknown until then.
+ *
+ * Lines that don't fill the display height exactly leave a few lines at the
+ * bottom, they are sent with every new line at the bottom. Choose a line
+ * height that divides the display height for the cheapest scrolling.
+ */
+class Console {
+public:
+  /**
+   * Create a console covering the entire display, allocates a line of
+   * pixels and a line of text. Check isValid.
+   *
+   * @param display to print to.
+   * @param font to print with.
+   * @param lineHeight in pixels, at least the font height (default).
+   */
+  Console(Implementation* display, const Font* font, uint8_t lineHeight = 0);
+  ~Console();
+  // Owns its buffers, not copyable.
+  Console(const Console&) = delete;
+  Console& operator=(const Console&) = delete;
+
+  /**
+   * Whether the buffers could be allocated. Without them the console has no
+   * columns or rows and printing returns ERROR_INVALID_ARGUMENT.
+   */
+  bool isValid();
+
+  /**
+   * Set the text and background level, the font is blended between them.
+   * Applies to text printed afterwards.
+   * @param foreground 0x0 - 0xf.
+   * @param background 0x0 - 0xf.
+   */
+  void setColors(uint8_t foreground, uint8_t background);
+  /**
+   * Fill the display with the background level and move the cursor to the
+   * top left.
+   */
+  uint8_t clear();
+  /**
+   * Write a character at the cursor, it's shown on the next flush. Handles
+   * '\n', '\r' and '\t', characters missing in the font are shown as '?'.
+   */
+  uint8_t write(char c);
+  /**
+   * Write a string and flush.
+   */
+  uint8_t print(const char* text);
+  /**
+   * Format like printf, write the result and flush. Output longer than
+   * SSD1327_CONSOLE_BUFFER - 1 characters is cut off.
+   */
+  uint8_t printf(const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+  /**
+   * Send the changed part of the current line to the display.
+   */
+  uint8_t flush();
+  uint8_t getColumns();
+  uint8_t getRows();
+
+private:
+  Implementation* _display;
+  const Font* _font;
+  uint8_t _lineHeight;
+  uint8_t _columns;
+  uint8_t _rows;
+  uint8_t _column = 0;
+  uint8_t _row = 0;
+  // Text of the current line and its pixels.
+  char* _text;
+  uint8_t* _pixels;
+  // Changed pixels of the current line, x0 >= x1 if nothing changed, and
+  // whether the lines under the last line have to be sent too.
+  uint8_t _dirtyX0 = 0;
+  uint8_t _dirtyX1 = 0;
+  bool _dirtyBottom = false;
+  // Font coverage to display level.
+  uint8_t _levels[16];
+  uint8_t _background = 0;
+
+  uint8_t _newLine();
+  void _markDirty(uint8_t x0, uint8_t x1);
+  int16_t _glyph(char c);
+};
+};
+#endif
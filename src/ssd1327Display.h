@@ -0,0 +1,293 @@
+/*
+ * Compile time specialized display for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_DISPLAY_H
+#define SSD1327_DISPLAY_H
+
+#include <stdint.h>
+#include <string.h>
+#include "ssd1327.h"
+#include "ssd1327FrameBuffer.h"
+#include "ssd1327Init.h"
+#include "ssd1327Nibbles.h"
+
+namespace Ssd1327 {
+
+/**
+ * Display with its geometry and bus fixed at compile time.
+ *
+ * Alternative to `Implementation` with a `FrameBuffer` for small MCUs where
+ * the virtual calls and runtime geometry show up in profiles. Width, height,
+ * the number of segments and the buffer size are constants, so divisions are
+ * shifts and loops have known bounds. The frame buffer is an array inside the
+ * object, declare the display globally to keep it off the stack. The bus is
+ * held by value, its methods are called directly and can be inlined.
+ *
+ * Bus is any class with these methods of `Interface`: begin, hwReset,
+ * sendCommand(uint8_t*, uint8_t), sendData(uint8_t*, uint16_t), beginBurst
+ * and endBurst. E.g. `ArduinoSpiInterface`, calls on a member of a known type
+ * don't go through the vtable, or a class that doesn't derive from Interface
+ * at all.
+ *
+ * Drawing goes into the frame buffer and is tracked as one dirty rectangle,
+ * `flush` sends it in one address window. The start line stays at 0, so
+ * buffer lines are GDDRAM rows. There is no register cache, the window is set
+ * for every send (one command transaction).
+ */
+template<uint8_t Width, uint8_t Height, typename Bus>
+class Display {
+  static_assert(
+    Width > 0 && Width % 2 == 0 && Width <= SSD1327_GDDRAM_COLUMNS * 2,
+    "Width must be even and fit in GDDRAM"
+  );
+  static_assert(
+    Height >= 16 && Height <= SSD1327_GDDRAM_ROWS,
+    "Height must be 16 - 128, the MUX ratio range"
+  );
+
+public:
+  // Segments (bytes) per line and the size of the frame buffer.
+  static const uint8_t STRIDE = Width / 2;
+  static const uint16_t SIZE = (uint16_t)STRIDE * Height;
+
+  /**
+   * Create a display, the arguments are passed on to the constructor of Bus.
+   */
+  template<typename... Args>
+  explicit Display(Args&&... args): _bus(static_cast<Args&&>(args)...) {}
+
+  Bus& getBus() {
+    return _bus;
+  }
+
+  uint8_t* getBuffer() {
+    return _buffer;
+  }
+
+  /**
+   * Start the bus and initialise the display.
+   */
+  uint8_t begin() {
+    _bus.begin();
+    return init();
+  }
+
+  /**
+   * Configure the display in one command transaction, clear it and switch it
+   * on. Doesn't wait after switching on like `Implementation::init`, the
+   * panel takes about 100ms to show the image.
+   *
+   * @param sequence in flash (SSD1327_PROGMEM), see InitConfig. Its start
+   *        line is ignored, it stays at 0.
+   */
+  uint8_t init(const InitSequence* sequence = &defaultInitSequence) {
+    _bus.hwReset();
+    // Clear while the display is still off, switching it on goes last.
+    uint8_t config[InitSequence::Length + InitSequence::Tail];
+    loadInitSequence(config, sequence, Width, Height);
+    // Buffer lines are GDDRAM rows, whatever start line the sequence sets.
+    config[InitSequence::StartLine] = 0;
+    uint8_t error = _bus.sendCommand(config, sizeof(config) - 1);
+    if (error != 0) return error;
+    error = clear();
+    return error | sendCommand(config[sizeof(config) - 1]);
+  }
+
+  uint8_t sendCommand(uint8_t command) {
+    return _bus.sendCommand(&command, 1);
+  }
+
+  uint8_t sendCommand(uint8_t* command, uint8_t len) {
+    return _bus.sendCommand(command, len);
+  }
+
+  uint8_t sendData(uint8_t* data, uint16_t len) {
+    return _bus.sendData(data, len);
+  }
+
+  /**
+   * Set the address window, in segments and rows, both ends inclusive.
+   */
+  uint8_t setWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    uint8_t command[6] = {
+      (uint8_t)Implementation::Cmd::SetColumnRange, x0, x1,
+      (uint8_t)Implementation::Cmd::SetRowRange, y0, y1
+    };
+    return _bus.sendCommand(command, 6);
+  }
+
+  void setPixel(uint8_t x, uint8_t y, uint8_t level) {
+    if (x >= Width || y >= Height) return;
+    Nibbles::set(_buffer, (uint16_t)y * Width + x, level & 0x0f);
+    _markDirty(x / 2, y, x / 2, y);
+  }
+
+  uint8_t getPixel(uint8_t x, uint8_t y) {
+    if (x >= Width || y >= Height) return 0;
+    return Nibbles::get(_buffer, (uint16_t)y * Width + x);
+  }
+
+  /**
+   * Fill the frame buffer with one grayscale level.
+   */
+  void fill(uint8_t level) {
+    level &= 0x0f;
+    memset(_buffer, level << 4 | level, SIZE);
+    _markDirty(0, 0, STRIDE - 1, Height - 1);
+  }
+
+  /**
+   * Fill a rectangle of the frame buffer, clipped to the display.
+   */
+  void fillRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  ) {
+    if (!_clip(x, y, width, height)) return;
+    uint8_t *line = _buffer + (uint16_t)y * STRIDE;
+    for (uint8_t row = 0; row < height; row++, line += STRIDE) {
+      Nibbles::fill(line, x, width, level);
+    }
+    _markDirty(x / 2, y, (x + width - 1) / 2, y + height - 1);
+  }
+
+  /**
+   * Copy packed image data into the frame buffer, same format as
+   * `Implementation::renderImageData`. Clipped to the display.
+   */
+  void drawImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image
+  ) {
+    Rect rect;
+    if (_copyImage(x, y, width, height, image, rect)) {
+      _markDirty(rect.x0, rect.y0, rect.x1, rect.y1);
+    }
+  }
+
+  void markAllDirty() {
+    _markDirty(0, 0, STRIDE - 1, Height - 1);
+  }
+
+  bool isDirty() {
+    return _isDirty;
+  }
+
+  /**
+   * Send the dirty rectangle of the frame buffer to the display.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t flush() {
+    if (!_isDirty) return 0;
+    uint8_t error = _send(_dirty);
+    // Keep it dirty if it didn't arrive, the next flush retries.
+    if (error == 0) _isDirty = false;
+    return error;
+  }
+
+  /**
+   * Draw packed image data into the frame buffer and send the segments it
+   * covers right away, other dirty parts are left for flush. The frame buffer
+   * completes segments at an uneven x or width, any x works.
+   *
+   * @return Status of the transmission, 0 for success,
+   *         ERROR_INVALID_ARGUMENT if len is too short for the dimensions.
+   */
+  uint8_t renderImageData(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t *image,
+    uint16_t len
+  ) {
+    if (len < ((uint32_t)width * height + 1) / 2) {
+      return Implementation::ERROR_INVALID_ARGUMENT;
+    }
+    Rect rect;
+    if (!_copyImage(x, y, width, height, image, rect)) return 0;
+    uint8_t error = _send(rect);
+    if (error != 0) _markDirty(rect.x0, rect.y0, rect.x1, rect.y1);
+    return error;
+  }
+
+  /**
+   * Clear the frame buffer and the display.
+   */
+  uint8_t clear() {
+    fill(0);
+    return flush();
+  }
+
+private:
+  Bus _bus;
+  uint8_t _buffer[SIZE];
+  // Bounding box of the changes since the last flush, segments and rows.
+  Rect _dirty;
+  bool _isDirty = false;
+
+  /**
+   * Clip a rectangle to the display.
+   * @return false if nothing is left.
+   */
+  static bool _clip(uint8_t x, uint8_t y, uint8_t& width, uint8_t& height) {
+    if (x >= Width || y >= Height || width == 0 || height == 0) return false;
+    if ((uint16_t)x + width > Width) width = Width - x;
+    if ((uint16_t)y + height > Height) height = Height - y;
+    return true;
+  }
+
+  /**
+   * Copy image data into the frame buffer without marking it dirty.
+   * @param rect set to the segments and rows covered.
+   * @return false if the image is outside the display.
+   */
+  bool _copyImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+    Rect& rect
+  ) {
+    uint8_t w = width;
+    uint8_t h = height;
+    if (!_clip(x, y, w, h)) return false;
+    for (uint8_t row = 0; row < h; row++) {
+      uint32_t src = (uint32_t)row * width; // Nibble offset.
+      uint8_t* line = _buffer + (uint16_t)(y + row) * STRIDE;
+      Nibbles::place(line, x, image, src, w);
+    }
+    rect = {
+      (uint8_t)(x / 2), y, (uint8_t)((x + w - 1) / 2), (uint8_t)(y + h - 1)
+    };
+    return true;
+  }
+
+  void _markDirty(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    if (!_isDirty) {
+      _dirty = {x0, y0, x1, y1};
+      _isDirty = true;
+      return;
+    }
+    if (x0 < _dirty.x0) _dirty.x0 = x0;
+    if (y0 < _dirty.y0) _dirty.y0 = y0;
+    if (x1 > _dirty.x1) _dirty.x1 = x1;
+    if (y1 > _dirty.y1) _dirty.y1 = y1;
+  }
+
+  /**
+   * Send a rectangle of the frame buffer, see Nibbles::sendRect.
+   */
+  uint8_t _send(Rect rect) {
+    uint8_t error = setWindow(rect.x0, rect.y0, rect.x1, rect.y1);
+    if (error != 0) return error;
+    uint8_t buffer[SSD1327_DATA_BUFFER];
+    _bus.beginBurst();
+    error = Nibbles::sendRect(
+      _buffer + (uint16_t)rect.y0 * STRIDE + rect.x0, STRIDE,
+      rect.x1 - rect.x0 + 1, rect.y1 - rect.y0 + 1, buffer, sizeof(buffer),
+      [this](uint8_t* data, uint16_t len) { return _bus.sendData(data, len); }
+    );
+    uint8_t burstError = _bus.endBurst();
+    return error != 0 ? error : burstError;
+  }
+};
+
+template<uint8_t Width, uint8_t Height, typename Bus>
+const uint8_t Display<Width, Height, Bus>::STRIDE;
+template<uint8_t Width, uint8_t Height, typename Bus>
+const uint16_t Display<Width, Height, Bus>::SIZE;
+};
+#endif
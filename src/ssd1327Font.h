@@ -0,0 +1,82 @@
+/*
+ * Anti aliased bitmap fonts for the SSD1327 Grayscale driver library.
+ *
+ * Fonts are generated from TrueType/OpenType fonts with `bin/convertfont`,
+ * proportional fonts with `bin/convertfont --proportional`.
+ *
+ */
+#ifndef SSD1327_FONT_H
+#define SSD1327_FONT_H
+
+#include <stdint.h>
+
+namespace Ssd1327 {
+
+/**
+ * Monospaced font with 4-bit (16 level) anti aliased glyphs.
+ *
+ * Every glyph is a cell of width * height pixels, packed as nibbles like image
+ * data: the left pixel in the high order nibble, no padding at the end of
+ * lines. Glyphs follow each other without padding either, so glyph i starts
+ * at nibble i * width * height. The level of a pixel is the coverage of the
+ * glyph, 0 is background, 15 is foreground.
+ */
+struct Font {
+  // Glyph cell size in pixels.
+  uint8_t width;
+  uint8_t height;
+  // Character code of the first glyph and the number of glyphs.
+  uint8_t first;
+  uint8_t count;
+  const uint8_t* bits;
+};
+
+/**
+ * Glyph of a proportional font, a bitmap in the font's atlas cropped to the
+ * ink of the glyph.
+ */
+struct FontGlyph {
+  // Byte offset of the bitmap in the atlas. Lines of the bitmap are padded to
+  // whole bytes, so every line starts on a byte boundary.
+  uint16_t offset;
+  // Size of the bitmap, 0 for glyphs without ink (space).
+  uint8_t width;
+  uint8_t height;
+  // Position of the bitmap, left of the pen position and below the top of
+  // the line.
+  int8_t left;
+  uint8_t top;
+  // Pixels the pen moves after the glyph.
+  uint8_t advance;
+};
+
+/**
+ * Adjustment of the advance between two characters.
+ */
+struct FontKerning {
+  uint8_t left;
+  uint8_t right;
+  int8_t adjust;
+};
+
+/**
+ * Proportional font with 4-bit (16 level) anti aliased glyphs, rendered by
+ * TextRenderer.
+ *
+ * The glyph bitmaps are packed in one atlas, the level of a pixel is the
+ * coverage of the glyph, 0 is background, 15 is foreground. Kerning pairs are
+ * sorted by left, then right character.
+ */
+struct ProportionalFont {
+  // Line height in pixels.
+  uint8_t height;
+  // Character code of the first glyph and the number of glyphs.
+  uint8_t first;
+  uint8_t count;
+  const FontGlyph* glyphs;
+  const FontKerning* kerning;
+  uint16_t kerningCount;
+  const uint8_t* atlas;
+};
+};
+#endif
@@ -0,0 +1,1030 @@
+#include "ssd1327FrameBuffer.h"
+#include "ssd1327Nibbles.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Bytes of pixel data that cost about the same as setting up another window
+// (2 commands of 3 bytes plus their transaction overhead on I2C). Rectangles
+// are merged if the merge sends fewer extra bytes than this.
+#ifndef SSD1327_DIRTY_MERGE_COST
+#define SSD1327_DIRTY_MERGE_COST 16
+#endif
+
+using namespace Ssd1327;
+
+// Compare frame buffers a machine word at a time.
+typedef Nibbles::Word word_t;
+
+static uint16_t area(Rect r) {
+  return (uint16_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+}
+
+static Rect unite(Rect a, Rect b) {
+  Rect r;
+  r.x0 = a.x0 < b.x0 ? a.x0 : b.x0;
+  r.y0 = a.y0 < b.y0 ? a.y0 : b.y0;
+  r.x1 = a.x1 > b.x1 ? a.x1 : b.x1;
+  r.y1 = a.y1 > b.y1 ? a.y1 : b.y1;
+  return r;
+}
+
+// Extra bytes sent when a and b are sent as one rectangle instead of two.
+// Negative when they overlap.
+static int32_t mergeCost(Rect a, Rect b) {
+  return (int32_t)area(unite(a, b)) - area(a) - area(b);
+}
+
+void DirtyRects::add(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  Rect rect = {x0, y0, x1, y1};
+  // Keep merging until the new rectangle doesn't touch any other rectangle,
+  // a merge can make it overlap rectangles it didn't overlap before.
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < _count; i++) {
+      if (mergeCost(rect, _rects[i]) <= SSD1327_DIRTY_MERGE_COST) {
+        rect = unite(rect, _rects[i]);
+        _remove(i);
+        merged = true;
+        break;
+      }
+    }
+  }
+  if (_count < SSD1327_MAX_DIRTY_RECTS) {
+    _rects[_count++] = rect;
+    return;
+  }
+  // Full, merge with the rectangle that grows the least.
+  uint8_t best = 0;
+  int32_t bestCost = mergeCost(rect, _rects[0]);
+  for (uint8_t i = 1; i < _count; i++) {
+    int32_t cost = mergeCost(rect, _rects[i]);
+    if (cost < bestCost) {
+      best = i;
+      bestCost = cost;
+    }
+  }
+  rect = unite(rect, _rects[best]);
+  _remove(best);
+  add(rect.x0, rect.y0, rect.x1, rect.y1);
+}
+
+void DirtyRects::clear() {
+  _count = 0;
+}
+
+uint8_t DirtyRects::count() {
+  return _count;
+}
+
+Rect DirtyRects::get(uint8_t index) {
+  return _rects[index];
+}
+
+void DirtyRects::_remove(uint8_t index) {
+  _rects[index] = _rects[--_count];
+}
+
+FrameBuffer::FrameBuffer(uint8_t width, uint8_t height):
+  _width(width), _height(height), _stride(width / 2), _owned(true)
+{
+  _buffer = (uint8_t*)calloc(getSize(), sizeof(uint8_t));
+  _checkBuffer();
+}
+
+FrameBuffer::FrameBuffer(uint8_t width, uint8_t height, uint8_t* buffer):
+  _width(width), _height(height), _stride(width / 2), _buffer(buffer),
+  _owned(false)
+{
+  _checkBuffer();
+}
+
+/**
+ * Without a buffer the geometry is 0x0, every drawing method clips
+ * everything away.
+ */
+void FrameBuffer::_checkBuffer() {
+  if (_buffer != nullptr) return;
+  _width = 0;
+  _height = 0;
+  _stride = 0;
+}
+
+bool FrameBuffer::isValid() {
+  return _buffer != nullptr;
+}
+
+FrameBuffer::~FrameBuffer() {
+  disableDoubleBuffering();
+  if (_owned) free(_buffer);
+}
+
+bool FrameBuffer::enableDoubleBuffering(uint8_t* front) {
+  disableDoubleBuffering();
+  if (_buffer == nullptr) return false;
+  if (front == nullptr) {
+    front = (uint8_t*)malloc(getSize());
+    if (front == nullptr) return false;
+    _frontOwned = true;
+  }
+  _front = front;
+  _frontValid = false;
+  markAllDirty();
+  return true;
+}
+
+void FrameBuffer::disableDoubleBuffering() {
+  if (_frontOwned) free(_front);
+  _front = nullptr;
+  _frontOwned = false;
+  _frontValid = false;
+}
+
+bool FrameBuffer::isDoubleBuffered() {
+  return _front != nullptr;
+}
+
+uint8_t FrameBuffer::getWidth() {
+  return _width;
+}
+
+uint8_t FrameBuffer::getHeight() {
+  return _height;
+}
+
+uint8_t* FrameBuffer::getBuffer() {
+  return _buffer;
+}
+
+uint16_t FrameBuffer::getSize() {
+  return (uint16_t)_stride * _height;
+}
+
+void FrameBuffer::setOriginY(uint8_t y) {
+  _originY = y;
+}
+
+uint8_t FrameBuffer::getOriginY() {
+  return _originY;
+}
+
+/**
+ * Translate a display line to a line of the buffer, cutting off the lines
+ * above the buffer.
+ *
+ * @param skipped set to the number of lines cut off.
+ * @return false if nothing is left in the buffer.
+ */
+bool FrameBuffer::_toBuffer(uint8_t& y, uint8_t& height, uint8_t* skipped) {
+  uint8_t cut = 0;
+  if (y < _originY) {
+    if (_originY - y >= height) return false;
+    cut = _originY - y;
+    height -= cut;
+    y = 0;
+  } else {
+    y -= _originY;
+  }
+  if (skipped != nullptr) *skipped = cut;
+  return y < _height;
+}
+
+void FrameBuffer::setPixel(uint8_t x, uint8_t y, uint8_t level) {
+  uint8_t height = 1;
+  if (x >= _width || !_toBuffer(y, height, nullptr)) return;
+  Nibbles::set(_buffer + (uint16_t)y * _stride, x, level);
+  _dirty.add(x / 2, y, x / 2, y);
+}
+
+uint8_t FrameBuffer::getPixel(uint8_t x, uint8_t y) {
+  uint8_t height = 1;
+  if (x >= _width || !_toBuffer(y, height, nullptr)) return 0;
+  return Nibbles::get(_buffer + (uint16_t)y * _stride, x);
+}
+
+void FrameBuffer::fill(uint8_t level) {
+  if (_buffer == nullptr) return;
+  level &= 0x0f;
+  memset(_buffer, level << 4 | level, getSize());
+  markAllDirty();
+}
+
+void FrameBuffer::drawImage(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+  uint32_t offset
+) {
+  uint8_t skipped;
+  if (x >= _width || !_toBuffer(y, height, &skipped)) return;
+  offset += (uint32_t)skipped * width;
+  _copyImage(x, y, width, height, image, offset);
+  _markDirty(x, y, width, height);
+}
+
+void FrameBuffer::updateImage(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+  uint32_t offset
+) {
+  uint8_t skipped;
+  if (x >= _width || !_toBuffer(y, height, &skipped)) return;
+  offset += (uint32_t)skipped * width;
+  _copyImage(x, y, width, height, image, offset);
+  _syncFront(x, y, width, height);
+}
+
+void FrameBuffer::fillRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+) {
+  if (x >= _width || !_toBuffer(y, height, nullptr)) return;
+  _fillRect(x, y, width, height, level);
+  _markDirty(x, y, width, height);
+}
+
+void FrameBuffer::updateRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+) {
+  if (x >= _width || !_toBuffer(y, height, nullptr)) return;
+  _fillRect(x, y, width, height, level);
+  _syncFront(x, y, width, height);
+}
+
+void FrameBuffer::drawHLine(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t level
+) {
+  fillRect(x, y, width, 1, level);
+}
+
+void FrameBuffer::drawVLine(
+  uint8_t x, uint8_t y, uint8_t height, uint8_t level
+) {
+  fillRect(x, y, 1, height, level);
+}
+
+/**
+ * Bresenham along the longer axis. The pixels of a line between two steps on
+ * the shorter axis are one run, drawn as one span: a shallow line is a few
+ * horizontal runs, not a pixel at a time.
+ */
+void FrameBuffer::drawLine(
+  uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level
+) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  // Major (a) and minor (b) axis.
+  int16_t a0 = steep ? y0 : x0;
+  int16_t a1 = steep ? y1 : x1;
+  int16_t b = steep ? x0 : y0;
+  int16_t b1 = steep ? x1 : y1;
+  int16_t da = abs(a1 - a0);
+  int16_t db = abs(b1 - b);
+  int8_t sa = a0 < a1 ? 1 : -1;
+  int8_t sb = b < b1 ? 1 : -1;
+  int16_t error = da / 2;
+  int16_t start = a0;
+  for (int16_t a = a0, i = 0; i <= da; a += sa, i++) {
+    error -= db;
+    if (error >= 0 && i < da) continue;
+    int16_t low = start < a ? start : a;
+    int16_t length = abs(a - start) + 1;
+    if (steep) {
+      _span(b, low, 1, length, level);
+    } else {
+      _span(low, b, length, 1, level);
+    }
+    start = a + sa;
+    b += sb;
+    error += da;
+  }
+}
+
+void FrameBuffer::drawRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+) {
+  if (width == 0 || height == 0) return;
+  if (width <= 2 || height <= 2) {
+    fillRect(x, y, width, height, level);
+    return;
+  }
+  _span(x, y, width, 1, level);
+  _span(x, y + height - 1, width, 1, level);
+  _span(x, y + 1, 1, height - 2, level);
+  _span(x + width - 1, y + 1, 1, height - 2, level);
+}
+
+void FrameBuffer::drawCircle(
+  uint8_t x, uint8_t y, uint8_t radius, uint8_t level
+) {
+  _arcs(x, y, x, y, radius, false, level);
+}
+
+void FrameBuffer::fillCircle(
+  uint8_t x, uint8_t y, uint8_t radius, uint8_t level
+) {
+  _arcs(x, y, x, y, radius, true, level);
+}
+
+void FrameBuffer::drawRoundRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius,
+  uint8_t level
+) {
+  if (width == 0 || height == 0) return;
+  if (radius > (width - 1) / 2) radius = (width - 1) / 2;
+  if (radius > (height - 1) / 2) radius = (height - 1) / 2;
+  int16_t right = x + width - 1;
+  int16_t bottom = y + height - 1;
+  // Straight edges between the corners.
+  _span(x + radius, y, width - 2 * radius, 1, level);
+  _span(x + radius, bottom, width - 2 * radius, 1, level);
+  _span(x, y + radius, 1, height - 2 * radius, level);
+  _span(right, y + radius, 1, height - 2 * radius, level);
+  _arcs(
+    x + radius, y + radius, right - radius, bottom - radius, radius, false,
+    level
+  );
+}
+
+void FrameBuffer::fillRoundRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius,
+  uint8_t level
+) {
+  if (width == 0 || height == 0) return;
+  if (radius > (width - 1) / 2) radius = (width - 1) / 2;
+  if (radius > (height - 1) / 2) radius = (height - 1) / 2;
+  // Full width between the corners, the corners add the lines above and
+  // below.
+  _span(x, y + radius, width, height - 2 * radius, level);
+  _arcs(
+    x + radius, y + radius, x + width - 1 - radius, y + height - 1 - radius,
+    radius, true, level
+  );
+}
+
+/**
+ * Fill a rectangle that may start left of or above the display.
+ */
+void FrameBuffer::_span(
+  int16_t x, int16_t y, int16_t width, int16_t height, uint8_t level
+) {
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  if (y < 0) {
+    height += y;
+    y = 0;
+  }
+  if (width <= 0 || height <= 0 || x > 0xff || y > 0xff) return;
+  fillRect(x, y, width > 0xff ? 0xff : width, height > 0xff ? 0xff : height,
+    level);
+}
+
+/**
+ * Draw the four quarter circles of a circle or rounded rectangle, with the
+ * centres of the quarters at the corners of the rectangle left, top, right,
+ * bottom (a point for a circle).
+ *
+ * Midpoint circle over one octant. The points of the octant on one line are
+ * a run, it's drawn as a horizontal span near the top and bottom and as a
+ * vertical span on the sides. Filled, the sides are rectangles of lines of
+ * equal width.
+ */
+void FrameBuffer::_arcs(
+  int16_t left, int16_t top, int16_t right, int16_t bottom, uint8_t radius,
+  bool filled, uint8_t level
+) {
+  int16_t x = 0;
+  int16_t y = radius;
+  int16_t error = 1 - radius;
+  int16_t start = 0;
+  while (x <= y) {
+    int16_t nextY = y;
+    if (error < 0) {
+      error += 2 * x + 3;
+    } else {
+      error += 2 * (x - y) + 5;
+      nextY--;
+    }
+    if (nextY != y || x + 1 > nextY) {
+      // Run start..x on line y (and column y for the sides).
+      int16_t length = x - start + 1;
+      if (filled) {
+        int16_t width = right - left + 2 * x + 1;
+        _span(left - x, top - y, width, 1, level);
+        _span(left - x, bottom + y, width, 1, level);
+        width = right - left + 2 * y + 1;
+        _span(left - y, top - x, width, length, level);
+        _span(left - y, bottom + start, width, length, level);
+      } else {
+        _span(left - x, top - y, length, 1, level);
+        _span(right + start, top - y, length, 1, level);
+        _span(left - x, bottom + y, length, 1, level);
+        _span(right + start, bottom + y, length, 1, level);
+        _span(left - y, top - x, 1, length, level);
+        _span(right + y, top - x, 1, length, level);
+        _span(left - y, bottom + start, 1, length, level);
+        _span(right + y, bottom + start, 1, length, level);
+      }
+      start = x + 1;
+    }
+    x++;
+    y = nextY;
+  }
+}
+
+/**
+ * The display shows the segments covering the pixels already, keep the front
+ * buffer in sync so the next diff doesn't send them again.
+ */
+void FrameBuffer::_syncFront(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height
+) {
+  if (_front == nullptr || !_frontValid || width == 0 || height == 0) return;
+  uint8_t x1 = (uint16_t)x + width > _width ? _width - 1 : x + width - 1;
+  uint8_t y1 = (uint16_t)y + height > _height ? _height - 1 : y + height - 1;
+  Rect rect = {(uint8_t)(x / 2), y, (uint8_t)(x1 / 2), y1};
+  _copyToFront(rect);
+}
+
+void FrameBuffer::_fillRect(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+) {
+  uint8_t w = (uint16_t)x + width > _width ? _width - x : width;
+  uint8_t h = (uint16_t)y + height > _height ? _height - y : height;
+  uint8_t *line = _buffer + (uint16_t)y * _stride;
+  for (uint8_t row = 0; row < h; row++, line += _stride) {
+    Nibbles::fill(line, x, w, level);
+  }
+}
+
+void FrameBuffer::blit(
+  int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t* image,
+  int8_t transparent
+) {
+  uint8_t col;
+  uint8_t row;
+  uint8_t w;
+  uint8_t h;
+  if (!_clipImage(x, y, width, height, col, row, w, h)) return;
+  int16_t top = y - _originY;
+  for (uint8_t i = row; i < row + h; i++) {
+    uint8_t* line = _buffer + (uint16_t)(top + i) * _stride;
+    uint32_t src = (uint32_t)i * width + col;
+    if (transparent < 0) {
+      Nibbles::place(line, x + col, image, src, w);
+    } else {
+      _maskLine(line, x + col, image, src, w, transparent);
+    }
+  }
+  _markDirty(x + col, top + row, w, h);
+}
+
+void FrameBuffer::readImage(
+  int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t* image
+) {
+  uint8_t col;
+  uint8_t row;
+  uint8_t w;
+  uint8_t h;
+  if (!_clipImage(x, y, width, height, col, row, w, h)) return;
+  int16_t top = y - _originY;
+  for (uint8_t i = row; i < row + h; i++) {
+    const uint8_t* line = _buffer + (uint16_t)(top + i) * _stride;
+    uint32_t dst = (uint32_t)i * width + col;
+    uint8_t count = w;
+    uint8_t from = x + col;
+    if (dst % 2) {
+      Nibbles::set(image, dst++, Nibbles::get(line, from++));
+      count--;
+    }
+    Nibbles::copy(image + dst / 2, line, from, count & ~1);
+    if (count % 2) {
+      uint8_t last = count - 1;
+      Nibbles::set(image, dst + last, Nibbles::get(line, from + last));
+    }
+  }
+}
+
+/**
+ * Clip an image at display coordinates that may be partly outside the
+ * buffer.
+ *
+ * @param col set to the first column of the image in the buffer.
+ * @param row set to the first line of the image in the buffer.
+ * @param w set to the number of columns in the buffer.
+ * @param h set to the number of lines in the buffer.
+ * @return false if nothing of the image is in the buffer.
+ */
+bool FrameBuffer::_clipImage(
+  int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t& col,
+  uint8_t& row, uint8_t& w, uint8_t& h
+) {
+  int16_t top = y - _originY;
+  int16_t left = x < 0 ? -x : 0;
+  int16_t right = x + width > _width ? _width - x : width;
+  int16_t first = top < 0 ? -top : 0;
+  int16_t last = top + height > _height ? _height - top : height;
+  if (right <= left || last <= first) return false;
+  col = left;
+  row = first;
+  w = right - left;
+  h = last - first;
+  return true;
+}
+
+void FrameBuffer::_copyImage(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+  uint32_t offset
+) {
+  // Clip, the source keeps its original line length.
+  uint8_t w = (uint16_t)x + width > _width ? _width - x : width;
+  uint8_t h = (uint16_t)y + height > _height ? _height - y : height;
+  for (uint8_t row = 0; row < h; row++) {
+    uint32_t src = offset + (uint32_t)row * width; // Nibble offset.
+    uint8_t* line = _buffer + (uint16_t)(y + row) * _stride;
+    Nibbles::place(line, x, image, src, w);
+  }
+}
+
+/**
+ * Copy count pixels to column x of a line, leaving the pixels at the
+ * transparent level out.
+ *
+ * The pixels are realigned to the segments of the line into a stack buffer,
+ * half segments at the ends padded with the transparent level. Then a word
+ * at a time, every nibble that differs from the transparent level is turned
+ * into a nibble mask of 0xf by folding its bits into the lowest one.
+ */
+void FrameBuffer::_maskLine(
+  uint8_t* line, uint8_t x, const uint8_t* image, uint32_t src, uint8_t count,
+  uint8_t transparent
+) {
+  typedef Nibbles::Word Word;
+  const Word ones = (Word)-1 / 0xf; // 0x1111...
+  const Word key = ones * transparent;
+  uint8_t segments = (x + count - 1) / 2 - x / 2 + 1;
+  uint8_t buffer[SSD1327_GDDRAM_COLUMNS + 1];
+  uint8_t* pixels = buffer;
+  if (x % 2) {
+    buffer[0] = transparent << 4 | Nibbles::get(image, src++);
+    pixels++;
+    count--;
+  }
+  Nibbles::copy(pixels, image, src, count);
+  if (count % 2) pixels[count / 2] |= transparent;
+  line += x / 2;
+  uint8_t i = 0;
+  for (; i + sizeof(Word) <= segments; i += sizeof(Word)) {
+    Word sprite = Nibbles::loadBigEndian(buffer + i);
+    Word mask = sprite ^ key;
+    mask |= mask >> 1;
+    mask = ((mask | mask >> 2) & ones) * 0xf;
+    Word under = Nibbles::loadBigEndian(line + i);
+    Nibbles::storeBigEndian(line + i, (under & ~mask) | (sprite & mask));
+  }
+  for (; i < segments; i++) {
+    uint8_t mask = (buffer[i] >> 4 != transparent ? 0xf0 : 0) |
+      ((buffer[i] & 0x0f) != transparent ? 0x0f : 0);
+    line[i] = (line[i] & ~mask) | (buffer[i] & mask);
+  }
+}
+
+void FrameBuffer::markDirty(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height
+) {
+  if (!_toBuffer(y, height, nullptr)) return;
+  _markDirty(x, y, width, height);
+}
+
+// Mark a region dirty, in buffer lines.
+void FrameBuffer::_markDirty(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height
+) {
+  if (width == 0 || height == 0 || x >= _width || y >= _height) return;
+  uint8_t x1 = (uint16_t)x + width > _width ? _width - 1 : x + width - 1;
+  uint8_t y1 = (uint16_t)y + height > _height ? _height - 1 : y + height - 1;
+  _dirty.add(x / 2, y, x1 / 2, y1);
+}
+
+void FrameBuffer::invalidate(
+  uint8_t x, uint8_t y, uint8_t width, uint8_t height
+) {
+  if (!_toBuffer(y, height, nullptr)) return;
+  if (width == 0 || height == 0 || x >= _width) return;
+  _markDirty(x, y, width, height);
+  if (_front == nullptr || !_frontValid) return;
+  // Make the front buffer differ from the back buffer in every segment of
+  // the region, so the diff sends all of it.
+  uint8_t x1 = (uint16_t)x + width > _width ? _width - 1 : x + width - 1;
+  uint8_t y1 = (uint16_t)y + height > _height ? _height - 1 : y + height - 1;
+  for (uint8_t row = y; row <= y1; row++) {
+    uint16_t offset = (uint16_t)row * _stride;
+    for (uint8_t i = x / 2; i <= x1 / 2; i++) {
+      _front[offset + i] = ~_buffer[offset + i];
+    }
+  }
+}
+
+void FrameBuffer::markAllDirty() {
+  _dirty.clear();
+  if (_buffer == nullptr) return;
+  _dirty.add(0, 0, _stride - 1, _height - 1);
+}
+
+void FrameBuffer::clearDirty() {
+  _dirty.clear();
+  _resendAll = false;
+}
+
+/**
+ * An asynchronous flush that failed can't mark the buffer dirty from the
+ * completion context, drawing may be going on. It's done here, before the
+ * dirty rectangles are used next.
+ */
+void FrameBuffer::_takeFailedFlush() {
+  if (!_resendAll) return;
+  _resendAll = false;
+  markAllDirty();
+}
+
+void FrameBuffer::copyDirty(FrameBuffer* to) {
+  if (to->_width != _width || to->_height != _height) return;
+  _takeFailedFlush();
+  for (uint8_t i = 0; i < _dirty.count(); i++) {
+    Rect rect = _dirty.get(i);
+    uint16_t offset = (uint16_t)rect.y0 * _stride + rect.x0;
+    uint8_t segments = rect.x1 - rect.x0 + 1;
+    for (uint8_t row = rect.y0; row <= rect.y1; row++, offset += _stride) {
+      memcpy(to->_buffer + offset, _buffer + offset, segments);
+    }
+  }
+}
+
+bool FrameBuffer::isDirty() {
+  return _dirty.count() > 0 || _resendAll;
+}
+
+uint8_t FrameBuffer::flush(Implementation* display) {
+  if (_buffer == nullptr) return Implementation::ERROR_INVALID_ARGUMENT;
+  _takeFailedFlush();
+  uint8_t error = 0;
+  if (_front != nullptr && _frontValid) {
+    error = _flushDiff(display);
+    if (error == 0) _dirty.clear();
+    return error;
+  }
+  error = _beginFlush(display, &_dirty);
+  for (uint8_t i = 0; i < _dirty.count() && error == 0; i++) {
+    error = _flushRect(display, _dirty.get(i));
+  }
+  error = _endFlush(display, error);
+  if (error != 0) return error;
+  if (_front != nullptr) {
+    // The first flush after enabling double buffering sends everything.
+    memcpy(_front, _buffer, getSize());
+    _frontValid = true;
+  }
+  _dirty.clear();
+  return error;
+}
+
+/**
+ * Only the dirty rectangles can differ from the front buffer. Diff their lines
+ * and collect the changed spans, line by line. Spans on consecutive lines
+ * covering the same segments merge into one window in DirtyRects::add.
+ */
+uint8_t FrameBuffer::_flushDiff(Implementation* display) {
+  uint8_t error = 0;
+  DirtyRects spans;
+  _collectDiff(&spans);
+  error = _beginFlush(display, &spans);
+  for (uint8_t i = 0; i < spans.count() && error == 0; i++) {
+    Rect rect = spans.get(i);
+    error = _flushRect(display, rect);
+    if (error == 0) _copyToFront(rect);
+  }
+  error = _endFlush(display, error);
+  if (error != 0) {
+    // Part of the frame may have been sent, the front buffer is unreliable.
+    _frontValid = false;
+    markAllDirty();
+  }
+  return error;
+}
+
+void FrameBuffer::_collectDiff(DirtyRects* spans) {
+  for (uint8_t i = 0; i < _dirty.count(); i++) {
+    Rect rect = _dirty.get(i);
+    for (uint8_t row = rect.y0; row <= rect.y1; row++) {
+      _diffLine(row, rect.x0, rect.x1, spans);
+    }
+  }
+}
+
+uint8_t FrameBuffer::flushAsync(
+  Implementation* display, DmaInterface::Callback callback, void* context
+) {
+  if (isFlushing() || _buffer == nullptr) {
+    return Implementation::ERROR_INVALID_ARGUMENT;
+  }
+  _takeFailedFlush();
+  DmaInterface* dma = display->interface->getDma();
+  if (dma == nullptr || display->getRotation() % 180 != 0) {
+    uint8_t error = flush(display);
+    _flushError = error;
+    if (callback != nullptr) callback(context, error);
+    return error;
+  }
+  // The buffer can't change until the flush completed, so the front buffer
+  // is updated right away. It's invalidated if sending fails.
+  _sending.clear();
+  if (_front != nullptr && _frontValid) {
+    _collectDiff(&_sending);
+    for (uint8_t i = 0; i < _sending.count(); i++) {
+      _copyToFront(_sending.get(i));
+    }
+  } else {
+    _sending = _dirty;
+    if (_front != nullptr) {
+      memcpy(_front, _buffer, getSize());
+      _frontValid = true;
+    }
+  }
+  _dirty.clear();
+  _display = display;
+  _callback = callback;
+  _context = context;
+  _flushError = 0;
+  if (_sending.count() == 0) {
+    if (callback != nullptr) callback(context, 0);
+    return 0;
+  }
+  _sendIndex = 0;
+  _sendRow = _sending.get(0).y0;
+  __atomic_store_n(&_nextWindow, false, __ATOMIC_RELAXED);
+  __atomic_store_n(&_flushing, true, __ATOMIC_RELEASE);
+  dma->setCallback(_onTransfer, this);
+  return _sendWindow();
+}
+
+/**
+ * Set up the window of the next rectangle if the completion callback got to
+ * it, commands block so they're sent from here rather than the callback.
+ */
+bool FrameBuffer::isFlushing() {
+  if (!__atomic_load_n(&_flushing, __ATOMIC_ACQUIRE)) return false;
+  if (__atomic_exchange_n(&_nextWindow, false, __ATOMIC_ACQ_REL)) {
+    _sendWindow();
+  }
+  return __atomic_load_n(&_flushing, __ATOMIC_ACQUIRE);
+}
+
+uint8_t FrameBuffer::getFlushError() {
+  return _flushError;
+}
+
+void FrameBuffer::_onTransfer(void* context, uint8_t status) {
+  FrameBuffer* frame = (FrameBuffer*)context;
+  if (status != 0) {
+    frame->_finishAsync(status);
+    return;
+  }
+  frame->_sendNext();
+}
+
+/**
+ * Set up the window of the rectangle at _sendIndex and start sending it, from
+ * flushAsync or isFlushing.
+ */
+uint8_t FrameBuffer::_sendWindow() {
+  Rect rect = _sending.get(_sendIndex);
+  uint8_t error = 0;
+  _display->beginCommandBatch();
+  error |= _display->setColumnRange(rect.x0, rect.x1);
+  error |= _display->setRowRange(rect.y0 + _originY, rect.y1 + _originY);
+  error |= _display->endCommandBatch();
+  if (error != 0) {
+    _finishAsync(error);
+    return error;
+  }
+  return _sendNext();
+}
+
+/**
+ * Start the transfer of the next line(s) of the rectangle. At the end of a
+ * rectangle the next one needs a window first, that's left to isFlushing.
+ * The transfer may complete, and the next one start, before this returns,
+ * nothing is touched after starting it.
+ */
+uint8_t FrameBuffer::_sendNext() {
+  Rect rect = _sending.get(_sendIndex);
+  if (_sendRow > rect.y1) {
+    if (++_sendIndex == _sending.count()) {
+      _finishAsync(0);
+      return 0;
+    }
+    _sendRow = _sending.get(_sendIndex).y0;
+    __atomic_store_n(&_nextWindow, true, __ATOMIC_RELEASE);
+    return 0;
+  }
+  uint8_t error = 0;
+  uint8_t segments = rect.x1 - rect.x0 + 1;
+  uint8_t *line = _buffer + (uint16_t)_sendRow * _stride + rect.x0;
+  uint16_t len = segments;
+  if (segments == _stride) {
+    // Full lines are contiguous in memory, send the rest in one transfer.
+    len = (uint16_t)segments * (rect.y1 - _sendRow + 1);
+    _sendRow = rect.y1 + 1;
+  } else {
+    _sendRow++;
+  }
+  error = _display->sendDataAsync(line, len);
+  if (error != 0) _finishAsync(error);
+  return error;
+}
+
+void FrameBuffer::_finishAsync(uint8_t error) {
+  _display->interface->getDma()->setCallback(nullptr, nullptr);
+  if (error != 0) {
+    // Part of the frame may have been sent, it's all sent again next time.
+    _frontValid = false;
+    _resendAll = true;
+  }
+  _flushError = error;
+  DmaInterface::Callback callback = _callback;
+  void* context = _context;
+  __atomic_store_n(&_flushing, false, __ATOMIC_RELEASE);
+  if (callback != nullptr) callback(context, error);
+}
+
+void FrameBuffer::_diffLine(
+  uint8_t row, uint8_t x0, uint8_t x1, DirtyRects* spans
+) {
+  const uint8_t *back = _buffer + (uint16_t)row * _stride;
+  const uint8_t *front = _front + (uint16_t)row * _stride;
+  int16_t start = -1;
+  int16_t last = -1;
+  uint8_t i = x0;
+  while (i <= x1) {
+    if (x1 - i + 1 >= (int16_t)sizeof(word_t)) {
+      word_t a;
+      word_t b;
+      memcpy(&a, back + i, sizeof(word_t));
+      memcpy(&b, front + i, sizeof(word_t));
+      if (a == b) {
+        i += sizeof(word_t);
+        continue;
+      }
+    }
+    // Word differs or tail of the line, find the changed bytes.
+    uint8_t end = x1 - i + 1 >= (int16_t)sizeof(word_t) ?
+      i + sizeof(word_t) - 1 : x1;
+    for (; i <= end; i++) {
+      if (back[i] == front[i]) continue;
+      if (start < 0) {
+        start = i;
+      } else if (i - last - 1 > SSD1327_DIFF_MERGE_GAP) {
+        spans->add(start, row, last, row);
+        start = i;
+      }
+      last = i;
+    }
+    if (end == x1) break;
+  }
+  if (start >= 0) spans->add(start, row, last, row);
+}
+
+void FrameBuffer::_copyToFront(Rect rect) {
+  uint16_t offset = (uint16_t)rect.y0 * _stride + rect.x0;
+  uint8_t segments = rect.x1 - rect.x0 + 1;
+  for (uint8_t row = rect.y0; row <= rect.y1; row++, offset += _stride) {
+    memcpy(_front + offset, _buffer + offset, segments);
+  }
+}
+
+uint8_t FrameBuffer::_flushRect(Implementation* display, Rect rect) {
+  if (display->getRotation() % 180 != 0) {
+    return _flushTransposed(display, rect);
+  }
+  uint8_t error = 0;
+  // Window setup goes out in one transaction.
+  display->beginCommandBatch();
+  error |= display->setColumnRange(rect.x0, rect.x1);
+  error |= display->setRowRange(rect.y0 + _originY, rect.y1 + _originY);
+  error |= display->endCommandBatch();
+  if (error != 0) return error;
+  // Full lines are contiguous in memory, partial lines are gathered into one
+  // buffer to save transactions.
+  uint8_t chunk[SSD1327_FLUSH_BUFFER];
+  display->interface->beginBurst();
+  error = Nibbles::sendRect(
+    _buffer + (uint16_t)rect.y0 * _stride + rect.x0, _stride,
+    rect.x1 - rect.x0 + 1, rect.y1 - rect.y0 + 1, chunk, sizeof(chunk),
+    [display](uint8_t* data, uint16_t len) {
+      return display->sendData(data, len);
+    }
+  );
+  uint8_t burstError = display->interface->endBurst();
+  return error != 0 ? error : burstError;
+}
+
+/**
+ * Pick how a flush at 90 or 270 degrees is sent. Transposed, the panel rows
+ * are buffer columns: a line of the panel takes a byte from every line of the
+ * buffer. With vertical address increment the panel is filled a column (a
+ * pair of buffer lines) at a time instead, so both lines are read in order.
+ * That costs a remapping command before and after the flush, large flushes
+ * make up for it.
+ */
+uint8_t FrameBuffer::_beginFlush(Implementation* display, DirtyRects* rects) {
+  _columnMajor = false;
+  if (display->getRotation() % 180 == 0) return 0;
+  uint32_t bytes = 0;
+  for (uint8_t i = 0; i < rects->count(); i++) {
+    Rect rect = rects->get(i);
+    bytes += (uint16_t)(rect.x1 - rect.x0 + 1) * (rect.y1 - rect.y0 + 1);
+  }
+  if (bytes < SSD1327_ROTATE_STREAM_MIN) return 0;
+  _columnMajor = true;
+  return display->setVerticalAddressIncrement(true);
+}
+
+uint8_t FrameBuffer::_endFlush(Implementation* display, uint8_t error) {
+  if (!_columnMajor) return error;
+  _columnMajor = false;
+  uint8_t restored = display->setVerticalAddressIncrement(false);
+  return error != 0 ? error : restored;
+}
+
+/**
+ * At 90 degrees buffer column x is panel row x and the last buffer line is the
+ * left panel column. A panel segment holds a pixel of an even line (right) and
+ * of the line after it (left). 270 degrees is the same data, the controller
+ * turns it by 180.
+ */
+uint8_t FrameBuffer::_flushTransposed(Implementation* display, Rect rect) {
+  uint8_t error = 0;
+  uint8_t panelWidth = display->getWidth();
+  uint8_t x0 = rect.x0;
+  uint8_t x1 = rect.x1;
+  if (x1 >= display->getHeight() / 2) x1 = display->getHeight() / 2 - 1;
+  // First line of the first and the last pair.
+  uint16_t first = (rect.y0 + _originY) & ~1;
+  uint16_t last = (rect.y1 + _originY) & ~1;
+  if (last + 2 > panelWidth) last = panelWidth - 2;
+  if (x0 > x1 || first > last) return 0;
+  uint8_t column = (panelWidth - 2 - last) / 2;
+  uint8_t columns = (last - first) / 2 + 1;
+  display->beginCommandBatch();
+  error |= display->setColumnRange(column, column + columns - 1);
+  error |= display->setRowRange(x0 * 2, x1 * 2 + 1);
+  error |= display->endCommandBatch();
+  if (error != 0) return error;
+  uint8_t block[2 * SSD1327_GDDRAM_COLUMNS];
+  display->interface->beginBurst();
+  if (_columnMajor) {
+    // Panel columns left to right, each a pair of lines top to bottom.
+    uint8_t used = 0;
+    for (int16_t y = last; y >= (int16_t)first && error == 0; y -= 2) {
+      const uint8_t* left = _lineAt(y + 1);
+      const uint8_t* right = _lineAt(y);
+      for (uint8_t x = x0; x <= x1; x++) {
+        Nibbles::transpose(
+          left != nullptr ? left[x] : 0, right != nullptr ? right[x] : 0,
+          block[used], block[used + 1]
+        );
+        used += 2;
+        if (used == sizeof(block)) {
+          error = display->sendData(block, used);
+          used = 0;
+          if (error != 0) break;
+        }
+      }
+    }
+    if (error == 0 && used > 0) error = display->sendData(block, used);
+  } else {
+    // Blocks of panel rows that fit in the buffer, every line pair is read a
+    // run of bytes at a time for the whole block.
+    uint8_t pairs = sizeof(block) / (2 * columns);
+    for (uint8_t x = x0; x <= x1 && error == 0; x += pairs) {
+      uint8_t n = x1 - x + 1 < pairs ? x1 - x + 1 : pairs;
+      for (uint8_t i = 0; i < columns; i++) {
+        const uint8_t* left = _lineAt(last - 2 * i + 1);
+        const uint8_t* right = _lineAt(last - 2 * i);
+        uint8_t* out = block + i;
+        for (uint8_t j = x; j < x + n; j++, out += 2 * columns) {
+          Nibbles::transpose(
+            left != nullptr ? left[j] : 0, right != nullptr ? right[j] : 0,
+            out[0], out[columns]
+          );
+        }
+      }
+      error = display->sendData(block, (uint16_t)n * 2 * columns);
+    }
+  }
+  uint8_t burstError = display->interface->endBurst();
+  return error != 0 ? error : burstError;
+}
+
+// Line y in display coordinates, nullptr outside the band.
+const uint8_t* FrameBuffer::_lineAt(uint16_t y) {
+  if (y < _originY || y - _originY >= _height) return nullptr;
+  return _buffer + (uint16_t)(y - _originY) * _stride;
+}
@@ -0,0 +1,352 @@
+/*
+ * Frame buffer for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_FRAMEBUFFER_H
+#define SSD1327_FRAMEBUFFER_H
+
+#ifndef SSD1327_MAX_DIRTY_RECTS
+#define SSD1327_MAX_DIRTY_RECTS 8
+#endif
+#ifndef SSD1327_FLUSH_BUFFER
+#define SSD1327_FLUSH_BUFFER 64
+#endif
+// Unchanged bytes between two changes on a line that are sent anyway, instead
+// of splitting the line in two windows.
+#ifndef SSD1327_DIFF_MERGE_GAP
+#define SSD1327_DIFF_MERGE_GAP 8
+#endif
+// Bytes of a flush at 90 or 270 degrees from which it's sent with vertical
+// address increment, worth the 2 remapping commands around it.
+#ifndef SSD1327_ROTATE_STREAM_MIN
+#define SSD1327_ROTATE_STREAM_MIN 512
+#endif
+
+#include <stdint.h>
+#include "ssd1327.h"
+
+namespace Ssd1327 {
+
+/**
+ * Rectangle in display memory coordinates.
+ *
+ * Columns are segments (2 pixels, 1 byte), rows are display lines. Both the
+ * start and the end are inclusive, exactly like the values sent with
+ * Cmd::SetColumnRange and Cmd::SetRowRange.
+ */
+struct Rect {
+  uint8_t x0;
+  uint8_t y0;
+  uint8_t x1;
+  uint8_t y1;
+};
+
+/**
+ * List of damaged rectangles.
+ *
+ * Every rectangle costs a window setup on the bus (2 commands) so rectangles
+ * that overlap, touch or are close enough that sending the gap is cheaper than
+ * a new window are merged. When the list is full the new rectangle is merged
+ * into the one that grows the least.
+ */
+class DirtyRects {
+public:
+  /**
+   * Add a rectangle to the list, coordinates in segments and rows.
+   */
+  void add(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+  void clear();
+  uint8_t count();
+  Rect get(uint8_t index);
+
+private:
+  Rect _rects[SSD1327_MAX_DIRTY_RECTS];
+  uint8_t _count = 0;
+
+  void _remove(uint8_t index);
+};
+
+/**
+ * Packed 4-bit grayscale frame buffer.
+ *
+ * Memory layout is identical to the SSD1327 GDDRAM: 2 pixels per byte, the
+ * left pixel in the high order nibble, lines top to bottom. A 128x128 display
+ * takes 8K. All drawing is recorded as dirty rectangles so `flush` only sends
+ * the parts of the buffer that changed since the last flush.
+ *
+ * With double buffering enabled a second buffer (the front buffer) holds what
+ * the display shows. `flush` then compares the dirty parts of both buffers and
+ * only sends the segments that really differ, so the whole frame can be
+ * redrawn every time without sending it.
+ */
+class FrameBuffer {
+public:
+  /**
+   * Create a frame buffer, allocates width * height / 2 bytes. Check isValid,
+   * the allocation fails on small MCUs.
+   *
+   * @param width of the display in pixels, must be even.
+   * @param height of the display in pixels.
+   */
+  FrameBuffer(uint8_t width, uint8_t height);
+  /**
+   * Create a frame buffer on top of memory provided by the caller, e.g. a
+   * statically allocated array of width * height / 2 bytes.
+   */
+  FrameBuffer(uint8_t width, uint8_t height, uint8_t* buffer);
+  ~FrameBuffer();
+  // Owns its buffers, not copyable.
+  FrameBuffer(const FrameBuffer&) = delete;
+  FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+  /**
+   * Whether the buffer could be allocated. Without a buffer the frame buffer
+   * is 0x0 pixels: drawing does nothing and flush returns
+   * ERROR_INVALID_ARGUMENT.
+   */
+  bool isValid();
+
+  /**
+   * Enable diff based flushing with a front buffer.
+   *
+   * The first flush after enabling sends the entire frame, the display
+   * contents are unknown until then.
+   *
+   * @param front buffer of width * height / 2 bytes, allocated when omitted.
+   * @return false if the front buffer could not be allocated.
+   */
+  bool enableDoubleBuffering(uint8_t* front = nullptr);
+  void disableDoubleBuffering();
+  bool isDoubleBuffered();
+
+  uint8_t getWidth();
+  uint8_t getHeight();
+  uint8_t* getBuffer();
+  uint16_t getSize();
+  /**
+   * Set the display line of the first line of the buffer, for buffers that
+   * cover a band of the display (see StripRenderer). Drawing takes display
+   * coordinates and is clipped to the band, flush sends to the band's rows.
+   */
+  void setOriginY(uint8_t y);
+  uint8_t getOriginY();
+
+  void setPixel(uint8_t x, uint8_t y, uint8_t level);
+  uint8_t getPixel(uint8_t x, uint8_t y);
+  /**
+   * Fill the entire buffer with one grayscale level.
+   * @param level 0x0 - 0xf.
+   */
+  void fill(uint8_t level);
+  /**
+   * Fill a rectangle with one grayscale level, clipped to the buffer.
+   * @param level 0x0 - 0xf.
+   */
+  void fillRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  );
+  /**
+   * Fill a rectangle without marking it dirty, see updateImage.
+   */
+  void updateRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  );
+  /**
+   * Drawing primitives, clipped to the buffer. Horizontal runs of pixels are
+   * filled a segment (byte) at a time, only a pixel in half a segment at
+   * either end is merged. Every run is marked dirty as it's drawn.
+   *
+   * @param level 0x0 - 0xf.
+   */
+  void drawHLine(uint8_t x, uint8_t y, uint8_t width, uint8_t level);
+  void drawVLine(uint8_t x, uint8_t y, uint8_t height, uint8_t level);
+  void drawLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level);
+  void drawRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  );
+  void drawCircle(uint8_t x, uint8_t y, uint8_t radius, uint8_t level);
+  void fillCircle(uint8_t x, uint8_t y, uint8_t radius, uint8_t level);
+  void drawRoundRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius,
+    uint8_t level
+  );
+  void fillRoundRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius,
+    uint8_t level
+  );
+  /**
+   * Copy image data into the buffer, same format as
+   * `Implementation::renderImageData`: packed nibbles, no padding at the end
+   * of lines with an uneven width. Clipped to the buffer.
+   *
+   * @param offset of the first pixel in image, in pixels (nibbles), e.g. to
+   *        draw the bottom part of an image.
+   */
+  void drawImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+    uint32_t offset = 0
+  );
+  /**
+   * Copy image data into the buffer without marking it dirty, for images that
+   * were sent to the display already, e.g. by
+   * `Implementation::renderImageData` when this is its shadow buffer.
+   */
+  void updateImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+    uint32_t offset = 0
+  );
+  /**
+   * Copy image data into the buffer at any position, also partly outside the
+   * buffer, e.g. a sprite (see Sprite). Pixels at the transparent level are
+   * left out, a word of pixels at a time.
+   *
+   * @param transparent level 0x0 - 0xf, or -1 to copy every pixel.
+   */
+  void blit(
+    int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t* image,
+    int8_t transparent = -1
+  );
+  /**
+   * Copy pixels out of the buffer into image data, e.g. to save what a sprite
+   * covers. Pixels outside the buffer are left as they are in image.
+   */
+  void readImage(
+    int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t* image
+  );
+  /**
+   * Mark a region of pixels as changed, e.g. after writing to the buffer
+   * directly through `getBuffer`.
+   */
+  void markDirty(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+  void markAllDirty();
+  /**
+   * Forget the dirty rectangles, e.g. when the changes reached the display
+   * some other way.
+   */
+  void clearDirty();
+  /**
+   * Copy the dirty parts of this buffer into another buffer of the same size,
+   * without marking them dirty there. Brings the other buffer of a pair up to
+   * date, see FramePipeline.
+   */
+  void copyDirty(FrameBuffer* to);
+  /**
+   * Mark a region as changed and unknown on the display, e.g. after hardware
+   * scrolling moved it. Unlike markDirty, a double buffered flush sends the
+   * region even if the buffer didn't change.
+   */
+  void invalidate(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+  bool isDirty();
+  /**
+   * Send all dirty rectangles to the display, then forget them. Each
+   * rectangle gets its own address window, so only damaged segments are sent.
+   * When double buffered only the segments in the dirty rectangles that differ
+   * from the front buffer are sent.
+   *
+   * With the display rotated by 90 or 270 degrees (Implementation::setRotation)
+   * buffer lines are sent as panel columns, whole pairs of lines because a
+   * panel segment holds a pixel of both. Bands (see setOriginY) should start
+   * on an even line and have an even height then.
+   *
+   * @param display to send the data to.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t flush(Implementation* display);
+  /**
+   * Start flushing and return without waiting for the data, the display's
+   * interface must be a DmaInterface. Double buffered diffs are computed
+   * right away, then every rectangle is sent as full lines in one transfer or
+   * line by line, the next line is started from the completion of the
+   * previous one. Setting up the window of the next rectangle takes commands
+   * that block, that's done by isFlushing: call it while waiting, the flush
+   * stalls between rectangles otherwise. Without a DmaInterface, or rotated by
+   * 90 or 270 degrees, it flushes blocking.
+   *
+   * Don't draw or use the display until isFlushing returns false or the
+   * callback is called. A failed flush marks the whole buffer dirty when it's
+   * flushed next.
+   *
+   * @param callback called with the status when the flush completed, from
+   *        the interface's completion context (interrupt or thread) or from
+   *        isFlushing.
+   * @return Status of starting the flush, 0 for success.
+   */
+  uint8_t flushAsync(
+    Implementation* display, DmaInterface::Callback callback = nullptr,
+    void* context = nullptr
+  );
+  bool isFlushing();
+  // Status of the last flushAsync once isFlushing returns false.
+  uint8_t getFlushError();
+
+private:
+  uint8_t _width;
+  uint8_t _height;
+  uint8_t _stride;
+  uint8_t* _buffer;
+  bool _owned;
+  uint8_t* _front = nullptr;
+  bool _frontOwned = false;
+  bool _frontValid = false;
+  uint8_t _originY = 0;
+  // Rotated flush in progress with vertical address increment.
+  bool _columnMajor = false;
+  DirtyRects _dirty;
+  // State of an asynchronous flush: the rectangles being sent and the next
+  // line to send.
+  DirtyRects _sending;
+  uint8_t _sendIndex = 0;
+  uint8_t _sendRow = 0;
+  bool _flushing = false;
+  // The next rectangle needs its window set up, see isFlushing.
+  bool _nextWindow = false;
+  uint8_t _flushError = 0;
+  // An asynchronous flush failed, everything is dirty.
+  bool _resendAll = false;
+  Implementation* _display = nullptr;
+  DmaInterface::Callback _callback = nullptr;
+  void* _context = nullptr;
+
+  void _copyImage(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+    uint32_t offset
+  );
+  void _fillRect(
+    uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t level
+  );
+  void _checkBuffer();
+  bool _toBuffer(uint8_t& y, uint8_t& height, uint8_t* skipped);
+  bool _clipImage(
+    int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t& col,
+    uint8_t& row, uint8_t& w, uint8_t& h
+  );
+  static void _maskLine(
+    uint8_t* line, uint8_t x, const uint8_t* image, uint32_t src,
+    uint8_t count, uint8_t transparent
+  );
+  void _span(
+    int16_t x, int16_t y, int16_t width, int16_t height, uint8_t level
+  );
+  void _arcs(
+    int16_t left, int16_t top, int16_t right, int16_t bottom, uint8_t radius,
+    bool filled, uint8_t level
+  );
+  void _markDirty(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+  void _syncFront(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+  uint8_t _flushRect(Implementation* display, Rect rect);
+  uint8_t _beginFlush(Implementation* display, DirtyRects* rects);
+  uint8_t _endFlush(Implementation* display, uint8_t error);
+  uint8_t _flushTransposed(Implementation* display, Rect rect);
+  const uint8_t* _lineAt(uint16_t y);
+  uint8_t _flushDiff(Implementation* display);
+  void _collectDiff(DirtyRects* spans);
+  void _takeFailedFlush();
+  uint8_t _sendWindow();
+  uint8_t _sendNext();
+  void _finishAsync(uint8_t error);
+  static void _onTransfer(void* context, uint8_t status);
+  void _diffLine(uint8_t row, uint8_t x0, uint8_t x1, DirtyRects* spans);
+  void _copyToFront(Rect rect);
+};
+};
+#endif
@@ -0,0 +1,256 @@
+/*
+ * Compile time init sequences for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_INIT_H
+#define SSD1327_INIT_H
+
+#include <stdint.h>
+#include <string.h>
+#include "ssd1327.h"
+
+// Places constant data in flash on AVR, where constants are copied to RAM
+// otherwise. Other platforms keep constants in flash anyway.
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define SSD1327_PROGMEM PROGMEM
+#else
+#define SSD1327_PROGMEM
+#endif
+
+namespace Ssd1327 {
+
+/**
+ * Flat sequence of commands and arguments that configures the display, built
+ * at compile time by `InitConfig::build`.
+ *
+ * The settings that depend on the display size (MUX ratio, address window)
+ * and switching the display on are appended when it's sent, see
+ * `loadInitSequence`. The indexes are the positions of the arguments, they
+ * are used to fill the register cache after sending.
+ */
+struct InitSequence {
+  enum Index: uint8_t {
+    McuProtect            = 1,
+    Remapping             = 5,
+    StartLine             = 7,
+    DisplayOffset         = 9,
+    VddRegulator          = 11,
+    ContrastLevel         = 13,
+    PhaseLength           = 15,
+    DisplayClock          = 17,
+    PreChargeVoltage      = 20,
+    ComDeselectVoltage    = 22,
+    SecondPrechargePeriod = 24,
+    FunctionSelectionB    = 26,
+    DisplayMode           = 27,
+    Length                = 28,
+    // Bytes appended when sending.
+    Tail                  = 9
+  };
+  uint8_t bytes[Length];
+};
+
+/**
+ * Display configuration, every setting starts at the default `init()` uses.
+ * Change settings by chaining, everything is constexpr so a sequence stored
+ * in flash costs no code to build:
+ *
+ *     static const Ssd1327::InitSequence sequence SSD1327_PROGMEM =
+ *       Ssd1327::InitConfig().contrastLevel(0x80).phaseLength(0x53).build();
+ *     display.init(&sequence);
+ */
+class InitConfig {
+  typedef Implementation::Cmd Cmd;
+  typedef Implementation::Const Const;
+  typedef Implementation::Default Default;
+
+public:
+  constexpr InitConfig():
+    _remapping(
+      (uint8_t)Const::ComSplitOddEvenOnMask |
+      (uint8_t)Const::ComRemappingOnMask | (uint8_t)Const::GddrRemappingOnMask
+    ),
+    _startLine((uint8_t)Default::StartLine),
+    _displayOffset((uint8_t)Default::DisplayOffset),
+    _vddRegulator(0x01),
+    _contrastLevel((uint8_t)Default::ContrastLevel),
+    _phaseLength((uint8_t)Default::PhaseLength),
+    _displayClock(
+      (uint8_t)Default::DisplayClockFrequency << 4 |
+      (uint8_t)Default::DisplayClockDivider
+    ),
+    _preChargeVoltage((uint8_t)Default::PreChargeVoltage),
+    _comDeselectVoltage((uint8_t)Default::ComDeselectVoltage),
+    _secondPrechargePeriod((uint8_t)Default::SecondPrechargePeriod),
+    _functionSelectionB((uint8_t)Default::FunctionSelectionB),
+    _displayMode((uint8_t)Cmd::SetDisplayNormal) {}
+
+  // Same arguments as the Implementation setters.
+  constexpr InitConfig remapping(
+    bool comSplitOddEven, bool comRemapping, bool verticalAddressIncrement,
+    bool nibbleRemapping, bool gddrRemapping
+  ) const {
+    return InitConfig(*this, InitSequence::Remapping, (uint8_t)(
+      (comSplitOddEven ? (uint8_t)Const::ComSplitOddEvenOnMask : 0) |
+      (comRemapping ? (uint8_t)Const::ComRemappingOnMask : 0) |
+      (verticalAddressIncrement ?
+        (uint8_t)Const::VerticalAddressIncrementMask : 0) |
+      (nibbleRemapping ? (uint8_t)Const::NibbleRemappingOnMask : 0) |
+      (gddrRemapping ? (uint8_t)Const::GddrRemappingOnMask : 0)
+    ));
+  }
+  constexpr InitConfig startLine(uint8_t line) const {
+    return InitConfig(*this, InitSequence::StartLine, line & 0x7f);
+  }
+  constexpr InitConfig displayOffset(uint8_t offset) const {
+    return InitConfig(*this, InitSequence::DisplayOffset, offset & 0x7f);
+  }
+  constexpr InitConfig vddRegulator(bool state) const {
+    return InitConfig(*this, InitSequence::VddRegulator, state ? 1 : 0);
+  }
+  constexpr InitConfig contrastLevel(uint8_t level) const {
+    return InitConfig(*this, InitSequence::ContrastLevel, level);
+  }
+  constexpr InitConfig phaseLength(uint8_t phaseLen) const {
+    return InitConfig(*this, InitSequence::PhaseLength, phaseLen);
+  }
+  constexpr InitConfig displayClock(uint8_t clock, uint8_t divider) const {
+    return InitConfig(
+      *this, InitSequence::DisplayClock, (uint8_t)(clock << 4 | divider)
+    );
+  }
+  constexpr InitConfig preChargeVoltage(uint8_t voltage) const {
+    return InitConfig(*this, InitSequence::PreChargeVoltage, voltage);
+  }
+  constexpr InitConfig comDeselectVoltage(uint8_t voltage) const {
+    return InitConfig(*this, InitSequence::ComDeselectVoltage, voltage);
+  }
+  constexpr InitConfig secondPrechargePeriod(uint8_t period) const {
+    return InitConfig(
+      *this, InitSequence::SecondPrechargePeriod,
+      period < 1 ? 1 : period & 0x0f
+    );
+  }
+  constexpr InitConfig functionSelectionB(uint8_t selection) const {
+    return InitConfig(
+      *this, InitSequence::FunctionSelectionB,
+      selection | (uint8_t)Const::FunctionSelectionBBase
+    );
+  }
+  /**
+   * @param mode Cmd::SetDisplayNormal, SetDisplayAllOn, SetDisplayAllOff or
+   *        SetDisplayInverse.
+   */
+  constexpr InitConfig displayMode(Cmd mode) const {
+    return InitConfig(*this, InitSequence::DisplayMode, (uint8_t)mode);
+  }
+
+  constexpr InitSequence build() const {
+    return InitSequence {{
+      // In case the display is in locked mode, unlock it.
+      (uint8_t)Cmd::McuProtectEnable, (uint8_t)Const::McuProtectEnableBase,
+      // Scrolling may still be active if the display wasn't reset.
+      (uint8_t)Cmd::DectivateScroll,
+      // Turn it off while it's configured.
+      (uint8_t)Cmd::DisplayOff,
+      (uint8_t)Cmd::SetRemapping, _remapping,
+      (uint8_t)Cmd::SetStartLine, _startLine,
+      (uint8_t)Cmd::SetDisplayOffset, _displayOffset,
+      (uint8_t)Cmd::EnableVddRegulator, _vddRegulator,
+      (uint8_t)Cmd::SetContrastLevel, _contrastLevel,
+      (uint8_t)Cmd::SetPhaseLength, _phaseLength,
+      (uint8_t)Cmd::SetDisplayClock, _displayClock,
+      // Reset the gray scale colour map to the default.
+      (uint8_t)Cmd::resetGrayscale,
+      (uint8_t)Cmd::SetPreChargeVoltage, _preChargeVoltage,
+      (uint8_t)Cmd::SetComDeselectVoltage, _comDeselectVoltage,
+      (uint8_t)Cmd::SetSecondPrechargePeriod, _secondPrechargePeriod,
+      (uint8_t)Cmd::FunctionSelectionB, _functionSelectionB,
+      _displayMode
+    }};
+  }
+
+private:
+  uint8_t _remapping;
+  uint8_t _startLine;
+  uint8_t _displayOffset;
+  uint8_t _vddRegulator;
+  uint8_t _contrastLevel;
+  uint8_t _phaseLength;
+  uint8_t _displayClock;
+  uint8_t _preChargeVoltage;
+  uint8_t _comDeselectVoltage;
+  uint8_t _secondPrechargePeriod;
+  uint8_t _functionSelectionB;
+  uint8_t _displayMode;
+
+  // Copy of other with one setting changed, constexpr allows no assignments.
+  constexpr InitConfig(const InitConfig& o, uint8_t index, uint8_t value):
+    _remapping(index == InitSequence::Remapping ? value : o._remapping),
+    _startLine(index == InitSequence::StartLine ? value : o._startLine),
+    _displayOffset(
+      index == InitSequence::DisplayOffset ? value : o._displayOffset
+    ),
+    _vddRegulator(
+      index == InitSequence::VddRegulator ? value : o._vddRegulator
+    ),
+    _contrastLevel(
+      index == InitSequence::ContrastLevel ? value : o._contrastLevel
+    ),
+    _phaseLength(index == InitSequence::PhaseLength ? value : o._phaseLength),
+    _displayClock(
+      index == InitSequence::DisplayClock ? value : o._displayClock
+    ),
+    _preChargeVoltage(
+      index == InitSequence::PreChargeVoltage ? value : o._preChargeVoltage
+    ),
+    _comDeselectVoltage(
+      index == InitSequence::ComDeselectVoltage ?
+        value : o._comDeselectVoltage
+    ),
+    _secondPrechargePeriod(
+      index == InitSequence::SecondPrechargePeriod ?
+        value : o._secondPrechargePeriod
+    ),
+    _functionSelectionB(
+      index == InitSequence::FunctionSelectionB ?
+        value : o._functionSelectionB
+    ),
+    _displayMode(index == InitSequence::DisplayMode ? value : o._displayMode)
+    {}
+};
+
+// Sequence of `InitConfig()`, what `Implementation::init()` sends.
+extern const InitSequence defaultInitSequence;
+
+/**
+ * Copy a sequence from flash to a buffer and append the settings that depend
+ * on the display size, the address window and switching the display on.
+ *
+ * @param buffer of InitSequence::Length + InitSequence::Tail bytes.
+ * @param sequence in flash (SSD1327_PROGMEM).
+ */
+inline void loadInitSequence(
+  uint8_t* buffer, const InitSequence* sequence, uint8_t width,
+  uint8_t height
+) {
+  typedef Implementation::Cmd Cmd;
+#if defined(__AVR__)
+  memcpy_P(buffer, sequence->bytes, InitSequence::Length);
+#else
+  memcpy(buffer, sequence->bytes, InitSequence::Length);
+#endif
+  uint8_t* tail = buffer + InitSequence::Length;
+  *tail++ = (uint8_t)Cmd::SetMuxRatio;
+  *tail++ = height - 1;
+  *tail++ = (uint8_t)Cmd::SetColumnRange;
+  *tail++ = 0x00;
+  *tail++ = width / 2 - 1;
+  *tail++ = (uint8_t)Cmd::SetRowRange;
+  *tail++ = 0x00;
+  *tail++ = height - 1;
+  *tail = (uint8_t)Cmd::DisplayOn;
+}
+};
+#endif
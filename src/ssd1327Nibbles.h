@@ -0,0 +1,194 @@
+/*
+ * Packed nibble (4-bit pixel) helpers for the SSD1327 Grayscale driver
+ * library.
+ *
+ */
+#ifndef SSD1327_NIBBLES_H
+#define SSD1327_NIBBLES_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace Ssd1327 {
+namespace Nibbles {
+
+/**
+ * Machine word used for bulk operations on pixel data. 8 bytes (16 pixels)
+ * at a time on 64-bit hosts, 4 bytes (8 pixels) on MCUs.
+ */
+#if UINTPTR_MAX > 0xffffffff
+typedef uint64_t Word;
+#else
+typedef uint32_t Word;
+#endif
+
+/**
+ * Load a word from unaligned memory, first byte in the high order bits so
+ * shifting the word shifts pixels like they are laid out on the display.
+ */
+inline Word loadBigEndian(const uint8_t* bytes) {
+  Word word;
+  memcpy(&word, bytes, sizeof(Word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#if UINTPTR_MAX > 0xffffffff
+  word = __builtin_bswap64(word);
+#else
+  word = __builtin_bswap32(word);
+#endif
+#endif
+  return word;
+}
+
+inline void storeBigEndian(uint8_t* bytes, Word word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#if UINTPTR_MAX > 0xffffffff
+  word = __builtin_bswap64(word);
+#else
+  word = __builtin_bswap32(word);
+#endif
+#endif
+  memcpy(bytes, &word, sizeof(Word));
+}
+
+/**
+ * Level of the pixel at a nibble offset in packed pixel data.
+ */
+inline uint8_t get(const uint8_t* pixels, uint32_t offset) {
+  uint8_t byte = pixels[offset / 2];
+  return (offset & 1) ? byte & 0x0f : byte >> 4;
+}
+
+/**
+ * Set the pixel at a nibble offset in packed pixel data, leaves the other
+ * pixel in the byte as it is.
+ */
+inline void set(uint8_t* pixels, uint32_t offset, uint8_t level) {
+  uint8_t *byte = pixels + offset / 2;
+  if (offset & 1) {
+    *byte = (*byte & 0xf0) | (level & 0x0f);
+  } else {
+    *byte = (*byte & 0x0f) | (level << 4);
+  }
+}
+
+/**
+ * Copy a run of pixels from a packed nibble stream to the start of a byte
+ * buffer, shifting them by one nibble if the run starts in the middle of a
+ * byte. Shifting is done a word at a time, the source is never read beyond
+ * the byte holding the last pixel.
+ *
+ * @param dst buffer of at least (count + 1) / 2 bytes.
+ * @param src packed pixels.
+ * @param offset of the first pixel in src, in nibbles.
+ * @param count of pixels to copy, if uneven the low order nibble of the last
+ *        byte is set to 0.
+ */
+inline void copy(uint8_t* dst, const uint8_t* src, uint32_t offset,
+  uint16_t count) {
+  src += offset / 2;
+  uint16_t bytes = count / 2;
+  if (offset % 2 == 0) {
+    memcpy(dst, src, bytes);
+    if (count % 2) dst[bytes] = src[bytes] & 0xf0;
+    return;
+  }
+  // Every output byte takes the low nibble of a source byte and the high
+  // nibble of the next one, so a word needs the byte after it too.
+  uint16_t i = 0;
+  for (; i + sizeof(Word) < bytes + 1u; i += sizeof(Word)) {
+    Word word = loadBigEndian(src + i);
+    storeBigEndian(dst + i, word << 4 | src[i + sizeof(Word)] >> 4);
+  }
+  for (; i < bytes; i++) {
+    dst[i] = src[i] << 4 | src[i + 1] >> 4;
+  }
+  if (count % 2) dst[bytes] = src[bytes] << 4;
+}
+
+/**
+ * Set count pixels of a line from pixel x on to one level. Whole segments are
+ * set with memset, only a pixel in half a segment at either end is merged.
+ */
+inline void fill(uint8_t* line, uint8_t x, uint8_t count, uint8_t level) {
+  if (count == 0) return;
+  level &= 0x0f;
+  uint8_t first = (x + 1) / 2;
+  uint8_t end = (x + count) / 2;
+  if (x % 2) set(line, x, level);
+  if (end > first) memset(line + first, level << 4 | level, end - first);
+  if ((x + count) % 2) set(line, x + count - 1, level);
+}
+
+/**
+ * Copy count pixels from a nibble offset in packed pixels to pixel x of a
+ * line. A first pixel in the low nibble of a segment and a last one in the
+ * high nibble are merged, the rest is copied a byte (or word) at a time.
+ */
+inline void place(
+  uint8_t* line, uint8_t x, const uint8_t* src, uint32_t offset, uint8_t count
+) {
+  if (x % 2 && count > 0) {
+    set(line, x++, get(src, offset++));
+    count--;
+  }
+  copy(line + x / 2, src, offset, count & ~1);
+  if (count % 2) {
+    uint8_t last = count - 1;
+    set(line, x + last, get(src, offset + last));
+  }
+}
+
+/**
+ * Send rows of a rectangle of packed pixels, segments bytes of every line of
+ * stride bytes, through send(uint8_t* data, uint16_t len). Lines as wide as
+ * the stride are contiguous and sent in one go. Narrower lines are packed
+ * back to back into buffer, the display's address window wraps to the next
+ * row by itself, so every call but the last sends a full buffer.
+ *
+ * @return Status of the first send that failed, 0 for success.
+ */
+template<typename Send>
+inline uint8_t sendRect(
+  uint8_t* line, uint8_t stride, uint8_t segments, uint8_t rows,
+  uint8_t* buffer, uint16_t size, Send send
+) {
+  if (segments == stride) return send(line, (uint16_t)segments * rows);
+  uint8_t error = 0;
+  uint16_t used = 0;
+  for (uint8_t row = 0; row < rows && error == 0; row++, line += stride) {
+    uint8_t done = 0;
+    while (done < segments) {
+      uint16_t n = segments - done;
+      if (n > size - used) n = size - used;
+      memcpy(buffer + used, line + done, n);
+      used += n;
+      done += n;
+      if (used == size) {
+        error = send(buffer, used);
+        used = 0;
+        if (error != 0) break;
+      }
+    }
+  }
+  if (error == 0 && used > 0) error = send(buffer, used);
+  return error;
+}
+
+/**
+ * Transpose 2x2 pixels, to turn an image by 90 degrees. left and right are a
+ * byte of 2 lines, the one that becomes the left pixels and the one that
+ * becomes the right pixels.
+ *
+ * @param first takes the high order (left) nibbles of both bytes.
+ * @param second takes the low order (right) nibbles of both bytes.
+ */
+inline void transpose(
+  uint8_t left, uint8_t right, uint8_t& first, uint8_t& second
+) {
+  first = (left & 0xf0) | right >> 4;
+  second = left << 4 | (right & 0x0f);
+}
+
+};
+};
+#endif
@@ -0,0 +1,44 @@
+#include "ssd1327Pipeline.h"
+
+using namespace Ssd1327;
+
+/**
+ * The display contents are unknown, the first frame sends everything. Both
+ * buffers start out black.
+ */
+FramePipeline::FramePipeline(
+  Implementation* display, FrameBuffer* first, FrameBuffer* second
+): _display(display) {
+  _frames[0] = first;
+  _frames[1] = second;
+  first->fill(0);
+  second->fill(0);
+  second->clearDirty();
+}
+
+FrameBuffer* FramePipeline::getFrame() {
+  return _frames[_back];
+}
+
+uint8_t FramePipeline::swap() {
+  FrameBuffer* back = _frames[_back];
+  FrameBuffer* other = _frames[1 - _back];
+  uint8_t error = finish();
+  if (error != 0) {
+    // Part of the frame before may be missing on the display, this frame
+    // replaces all of it.
+    back->markAllDirty();
+  }
+  // The other buffer has the frame before this one, and nothing dirty.
+  other->clearDirty();
+  back->copyDirty(other);
+  _back = 1 - _back;
+  uint8_t flushError = back->flushAsync(_display);
+  return error != 0 ? error : flushError;
+}
+
+uint8_t FramePipeline::finish() {
+  FrameBuffer* other = _frames[1 - _back];
+  while (other->isFlushing()) {}
+  return other->getFlushError();
+}
@@ -0,0 +1,65 @@
+/*
+ * Pipelined frame buffers for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_PIPELINE_H
+#define SSD1327_PIPELINE_H
+
+#include <stdint.h>
+#include "ssd1327.h"
+#include "ssd1327FrameBuffer.h"
+
+namespace Ssd1327 {
+
+/**
+ * Two frame buffers that take turns, so the next frame is drawn while the
+ * last one is on the bus.
+ *
+ * Draw into `getFrame()` and call `swap` when the frame is complete: the
+ * frame is flushed asynchronously (`FrameBuffer::flushAsync`) and drawing
+ * continues in the other buffer right away. swap only waits if the frame
+ * before is still being sent.
+ *
+ * Both buffers hold the whole image, drawing can be incremental. On swap the
+ * dirty parts of the finished frame are copied into the other buffer before
+ * it's handed to the bus, so the other buffer catches up with the frame and
+ * starts clean. If a flush fails, the next frame resends everything.
+ *
+ * The frame buffers must have the size of the display and shouldn't be
+ * double buffered themselves. Without a DmaInterface swap flushes blocking.
+ */
+class FramePipeline {
+public:
+  /**
+   * @param display to flush to.
+   * @param first frame buffer, drawn into first.
+   * @param second frame buffer.
+   */
+  FramePipeline(
+    Implementation* display, FrameBuffer* first, FrameBuffer* second
+  );
+  /**
+   * Frame buffer to draw the next frame into.
+   */
+  FrameBuffer* getFrame();
+  /**
+   * Hand the current frame to the bus and switch to the other buffer. Waits
+   * for the frame before to be sent first.
+   *
+   * @return Status of starting the flush, or the status of the frame before
+   *         if it failed, 0 for success.
+   */
+  uint8_t swap();
+  /**
+   * Wait until the last swapped frame is on the display.
+   * @return Status of its flush, 0 for success.
+   */
+  uint8_t finish();
+
+private:
+  Implementation* _display;
+  FrameBuffer* _frames[2];
+  uint8_t _back = 0;
+};
+};
+#endif
@@ -0,0 +1,70 @@
+#include "ssd1327Rle.h"
+#include "ssd1327Nibbles.h"
+#include <string.h>
+
+using namespace Ssd1327;
+
+RleDecoder::RleDecoder(const uint8_t* data, uint32_t len):
+  _data(data), _end(data + len) {}
+
+/**
+ * Read the next token.
+ * @return false at the end of the data or if the token is cut off.
+ */
+bool RleDecoder::_next() {
+  if (_data >= _end) return false;
+  uint8_t token = *_data++;
+  if (token < 0x80) {
+    uint16_t count = token + 1;
+    uint16_t bytes = (count + 1) / 2;
+    if (_end - _data < bytes) return false;
+    _literal = count;
+    _offset = 0;
+    return true;
+  }
+  _level = token & 0x0f;
+  uint8_t count = (token >> 4) & 0x07;
+  if (count < 7) {
+    _run = count + 2;
+    return true;
+  }
+  if (_data >= _end) return false;
+  _run = *_data++ + 9;
+  return true;
+}
+
+uint16_t RleDecoder::read(uint8_t* out, uint16_t count) {
+  uint16_t done = 0;
+  while (done < count) {
+    if (_run == 0 && _literal == 0 && !_next()) break;
+    uint16_t n;
+    if (_run > 0) {
+      n = count - done < _run ? count - done : _run;
+      // Half a segment at either end, whole bytes in between.
+      uint16_t pos = done;
+      uint16_t left = n;
+      if (pos % 2) {
+        Nibbles::set(out, pos++, _level);
+        left--;
+      }
+      memset(out + pos / 2, _level << 4 | _level, left / 2);
+      if (left % 2) out[(pos + left) / 2] = _level << 4;
+      _run -= n;
+    } else {
+      n = count - done < _literal ? count - done : _literal;
+      uint16_t pos = done;
+      uint16_t left = n;
+      if (pos % 2) {
+        Nibbles::set(out, pos++, Nibbles::get(_data, _offset++));
+        left--;
+      }
+      Nibbles::copy(out + pos / 2, _data, _offset, left);
+      _offset += left;
+      _literal -= n;
+      // Skip the padding of a finished literal.
+      if (_literal == 0) _data += (_offset + 1) / 2;
+    }
+    done += n;
+  }
+  return done;
+}
@@ -0,0 +1,67 @@
+/*
+ * Run length encoded images for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_RLE_H
+#define SSD1327_RLE_H
+
+// Stack buffer compressed images are decoded into before sending, whole lines
+// at a time. At least a line of the display (64 bytes), images of an uneven
+// width are decoded a line at a time unless it holds 2 lines.
+#ifndef SSD1327_RLE_BUFFER
+#define SSD1327_RLE_BUFFER 256
+#endif
+#if SSD1327_RLE_BUFFER < 64
+#error "SSD1327_RLE_BUFFER must hold a line of the display"
+#endif
+
+#include <stdint.h>
+
+namespace Ssd1327 {
+
+/**
+ * Streaming decoder of nibble run length encoded images, as written by
+ * `bin/convertimage --compress`.
+ *
+ * The image is the same stream of pixels as packed image data (lines not
+ * padded), encoded as a sequence of tokens:
+ *
+ *     0nnnnnnn               n + 1 literal pixels follow, packed like image
+ *                            data, padded to a whole byte.
+ *     1ccc llll              c + 2 pixels of level l, c is 0 - 6.
+ *     1111 llll nnnnnnnn     n + 9 pixels of level l.
+ *
+ * Runs are filled a byte at a time and literals copied a byte (or word, when
+ * shifted by a nibble) at a time, so decoding costs about the same as copying
+ * raw image data. Flat UI art typically shrinks to a tenth.
+ */
+class RleDecoder {
+public:
+  /**
+   * @param data compressed image.
+   * @param len of data in bytes.
+   */
+  RleDecoder(const uint8_t* data, uint32_t len);
+  /**
+   * Decode the next pixels, packed into out from its first byte on. An
+   * uneven count leaves the low order nibble of the last byte 0.
+   *
+   * @param out buffer of at least (count + 1) / 2 bytes.
+   * @return pixels decoded, less than count at the end of the data.
+   */
+  uint16_t read(uint8_t* out, uint16_t count);
+
+private:
+  const uint8_t* _data;
+  const uint8_t* _end;
+  // Pixels left of the current run or literal, and the run level or the
+  // nibble offset of the next literal pixel from _data.
+  uint16_t _run = 0;
+  uint8_t _level = 0;
+  uint16_t _literal = 0;
+  uint32_t _offset = 0;
+
+  bool _next();
+};
+};
+#endif
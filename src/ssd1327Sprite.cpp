@@ -0,0 +1,60 @@
+#include "ssd1327Sprite.h"
+
+using namespace Ssd1327;
+
+Sprite::Sprite(
+  uint8_t width, uint8_t height, const uint8_t* image, int8_t transparent,
+  uint8_t* saveUnder
+): _width(width), _height(height), _image(image), _transparent(transparent),
+  _saveUnder(saveUnder) {}
+
+void Sprite::setImage(const uint8_t* image) {
+  _image = image;
+}
+
+void Sprite::moveTo(int16_t x, int16_t y) {
+  _x = x;
+  _y = y;
+}
+
+void Sprite::setVisible(bool visible) {
+  _visible = visible;
+}
+
+bool Sprite::isVisible() {
+  return _visible;
+}
+
+int16_t Sprite::getX() {
+  return _x;
+}
+
+int16_t Sprite::getY() {
+  return _y;
+}
+
+bool Sprite::getDrawnBounds(int16_t& x, int16_t& y) {
+  x = _drawnX;
+  y = _drawnY;
+  return _drawn;
+}
+
+void Sprite::draw(FrameBuffer* frame) {
+  erase(frame);
+  if (!_visible) return;
+  if (_saveUnder != nullptr) {
+    frame->readImage(_x, _y, _width, _height, _saveUnder);
+  }
+  frame->blit(_x, _y, _width, _height, _image, _transparent);
+  _drawn = true;
+  _drawnX = _x;
+  _drawnY = _y;
+}
+
+void Sprite::erase(FrameBuffer* frame) {
+  if (!_drawn) return;
+  if (_saveUnder != nullptr) {
+    frame->blit(_drawnX, _drawnY, _width, _height, _saveUnder);
+  }
+  _drawn = false;
+}
@@ -0,0 +1,82 @@
+/*
+ * Sprites for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_SPRITE_H
+#define SSD1327_SPRITE_H
+
+#include <stdint.h>
+#include "ssd1327FrameBuffer.h"
+
+namespace Ssd1327 {
+
+/**
+ * Image that moves over the contents of a frame buffer, e.g. a cursor or a
+ * status icon.
+ *
+ * The image is packed image data like `Implementation::renderImageData`,
+ * pixels at the transparent level show what's under the sprite. Sprites can
+ * be at any position, also uneven x and partly off the display.
+ *
+ * With a save-under buffer the sprite keeps a copy of what it covers and
+ * puts it back when it moves, so only the old and the new position are
+ * changed and marked dirty, the frame buffer merges them for the next flush.
+ * Without one, redraw what's under the old position before drawing the
+ * sprite again, see getDrawnBounds.
+ *
+ * Overlapping sprites with save-under buffers have to be erased in the
+ * reverse order they were drawn, before any of them is drawn again.
+ */
+class Sprite {
+public:
+  /**
+   * @param image packed pixels, width * height.
+   * @param transparent level 0x0 - 0xf, or -1 for an opaque sprite.
+   * @param saveUnder buffer of (width * height + 1) / 2 bytes for what the
+   *        sprite covers, nullptr for none.
+   */
+  Sprite(
+    uint8_t width, uint8_t height, const uint8_t* image,
+    int8_t transparent = 0, uint8_t* saveUnder = nullptr
+  );
+
+  /**
+   * Change the image, e.g. to the next frame of an animated icon, of the same
+   * size. Shown on the next draw.
+   */
+  void setImage(const uint8_t* image);
+  void moveTo(int16_t x, int16_t y);
+  void setVisible(bool visible);
+  bool isVisible();
+  int16_t getX();
+  int16_t getY();
+  /**
+   * Position the sprite was last drawn at.
+   * @return false if it isn't drawn.
+   */
+  bool getDrawnBounds(int16_t& x, int16_t& y);
+  /**
+   * Erase the sprite from the position it was drawn at and draw it at its
+   * current position if it's visible.
+   */
+  void draw(FrameBuffer* frame);
+  /**
+   * Put back what the sprite covers, if it has a save-under buffer.
+   */
+  void erase(FrameBuffer* frame);
+
+private:
+  uint8_t _width;
+  uint8_t _height;
+  const uint8_t* _image;
+  int8_t _transparent;
+  uint8_t* _saveUnder;
+  int16_t _x = 0;
+  int16_t _y = 0;
+  bool _visible = true;
+  bool _drawn = false;
+  int16_t _drawnX = 0;
+  int16_t _drawnY = 0;
+};
+};
+#endif
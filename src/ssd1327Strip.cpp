@@ -0,0 +1,26 @@
+#include "ssd1327Strip.h"
+
+using namespace Ssd1327;
+
+StripRenderer::StripRenderer(Implementation* display, FrameBuffer* band):
+  _display(display), _band(band) {}
+
+uint8_t StripRenderer::render(
+  DrawCallback draw, void* context, uint8_t background
+) {
+  uint8_t error = 0;
+  uint8_t height = _display->getHeight();
+  uint8_t bandHeight = _band->getHeight();
+  for (uint16_t y = 0; y < height && error == 0; y += bandHeight) {
+    _band->setOriginY(y);
+    _band->fill(background);
+    draw(_band, context);
+    // Send the whole band, in one window, but not past the display.
+    uint8_t lines = y + bandHeight > height ? height - y : bandHeight;
+    _band->clearDirty();
+    _band->markDirty(0, y, _band->getWidth(), lines);
+    error = _band->flush(_display);
+  }
+  _band->setOriginY(0);
+  return error;
+}
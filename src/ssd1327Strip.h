@@ -0,0 +1,58 @@
+/*
+ * Strip (page mode) rendering for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_STRIP_H
+#define SSD1327_STRIP_H
+
+#include <stdint.h>
+#include "ssd1327.h"
+#include "ssd1327FrameBuffer.h"
+
+namespace Ssd1327 {
+
+/**
+ * Renders the display in horizontal bands with a frame buffer of only a few
+ * lines, for MCUs that can't spare the 8K of a full frame buffer.
+ *
+ * The application draws the whole frame in a callback, with display
+ * coordinates. The callback is called once per band, with the band's frame
+ * buffer moved to the band (`FrameBuffer::setOriginY`), drawing outside the
+ * band is clipped. Every band is sent as soon as it's drawn, in one address
+ * window. A 128x16 band takes 1K and renders a 128x128 frame in 8 passes, the
+ * cost is drawing every frame 8 times.
+ *
+ *     uint8_t bandMemory[128 * 16 / 2];
+ *     FrameBuffer band(128, 16, bandMemory);
+ *     StripRenderer strips(&display, &band);
+ *     strips.render(drawFrame, nullptr);
+ */
+class StripRenderer {
+public:
+  /**
+   * Draws the frame into the band, called for every band.
+   * @param band to draw into, with display coordinates.
+   * @param context as passed to render.
+   */
+  typedef void (*DrawCallback)(FrameBuffer* band, void* context);
+
+  /**
+   * @param display to render to.
+   * @param band frame buffer as wide as the display, any height.
+   */
+  StripRenderer(Implementation* display, FrameBuffer* band);
+  /**
+   * Render a frame: for every band, fill it with the background level, call
+   * draw and send it.
+   *
+   * @param background level 0x0 - 0xf the band is cleared with.
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t render(DrawCallback draw, void* context, uint8_t background = 0);
+
+private:
+  Implementation* _display;
+  FrameBuffer* _band;
+};
+};
+#endif
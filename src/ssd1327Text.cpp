@@ -0,0 +1,228 @@
+#include "ssd1327Text.h"
+#include "ssd1327Nibbles.h"
+#include <string.h>
+
+using namespace Ssd1327;
+
+#if SSD1327_TEXT_BUFFER < SSD1327_GDDRAM_COLUMNS
+#error "SSD1327_TEXT_BUFFER must hold a line of the display"
+#endif
+
+TextRenderer::TextRenderer(const ProportionalFont* font): _font(font) {
+  setColors(0x0f, 0x00);
+}
+
+void TextRenderer::setColors(uint8_t foreground, uint8_t background) {
+  foreground &= 0x0f;
+  background &= 0x0f;
+  for (uint8_t i = 0; i < 16; i++) {
+    int16_t blend = ((int16_t)foreground - background) * i;
+    // Round to the nearest level, both ways.
+    blend = blend < 0 ? (blend - 7) / 15 : (blend + 7) / 15;
+    _levels[i] = background + blend;
+  }
+  _mapLevels = foreground != 0x0f || background != 0x00;
+}
+
+uint8_t TextRenderer::getHeight() {
+  return _font->height;
+}
+
+uint16_t TextRenderer::measure(const char* text) {
+  int16_t pen = 0;
+  for (const char* c = text; *c != '\0'; c++) {
+    pen += _glyph(*c)->advance + _kerning(c[0], c[1]);
+  }
+  return pen < 0 ? 0 : pen;
+}
+
+void TextRenderer::draw(
+  FrameBuffer* frame, uint8_t x, uint8_t y, const char* text
+) {
+  uint8_t left;
+  uint8_t width;
+  int16_t origin;
+  if (!_box(x, text, false, frame->getWidth(), left, width, origin)) return;
+  // A frame can be wider than the display, wider boxes are drawn in parts of
+  // a display line.
+  const uint8_t part = SSD1327_GDDRAM_COLUMNS * 2;
+  uint8_t line[SSD1327_GDDRAM_COLUMNS];
+  for (uint8_t row = 0; row < _font->height && y + row <= 0xff; row++) {
+    for (uint16_t done = 0; done < width; done += part) {
+      uint8_t n = width - done < part ? width - done : part;
+      _renderRow(text, origin - done, row, line, n);
+      frame->drawImage(left + done, y + row, n, 1, line);
+    }
+  }
+}
+
+uint8_t TextRenderer::render(
+  Implementation* display, uint8_t x, uint8_t y, const char* text
+) {
+  uint8_t left;
+  uint8_t width;
+  int16_t origin;
+  if (y >= display->getHeight()) return 0;
+  if (!_box(x, text, true, display->getWidth(), left, width, origin)) {
+    return 0;
+  }
+  uint8_t height = _font->height;
+  if (y + height > display->getHeight()) height = display->getHeight() - y;
+  // As many whole lines as fit in the buffer per transfer.
+  uint8_t stride = width / 2;
+  uint16_t fit = SSD1327_TEXT_BUFFER / stride;
+  uint8_t lines = fit < height ? fit : height;
+  uint8_t buffer[SSD1327_TEXT_BUFFER];
+  uint8_t error = 0;
+  for (uint8_t row = 0; row < height && error == 0; row += lines) {
+    uint8_t n = height - row < lines ? height - row : lines;
+    for (uint8_t i = 0; i < n; i++) {
+      _renderRow(text, origin, row + i, buffer + i * stride, width);
+    }
+    error = display->renderImageData(
+      left, y + row, width, n, buffer, (uint16_t)n * stride
+    );
+  }
+  return error;
+}
+
+/**
+ * Glyph of a character, '?' for characters missing in the font.
+ */
+const FontGlyph* TextRenderer::_glyph(char c) {
+  uint8_t code = c;
+  if (code < _font->first || code - _font->first >= _font->count) {
+    code = '?';
+    if (code < _font->first || code - _font->first >= _font->count) {
+      code = _font->first;
+    }
+  }
+  return &_font->glyphs[code - _font->first];
+}
+
+/**
+ * Kerning between two characters, binary search of the sorted pairs.
+ */
+int8_t TextRenderer::_kerning(char left, char right) {
+  if (right == '\0') return 0;
+  uint16_t key = (uint8_t)left << 8 | (uint8_t)right;
+  uint16_t low = 0;
+  uint16_t high = _font->kerningCount;
+  while (low < high) {
+    uint16_t middle = (low + high) / 2;
+    const FontKerning& pair = _font->kerning[middle];
+    uint16_t pairKey = pair.left << 8 | pair.right;
+    if (pairKey == key) return pair.adjust;
+    if (pairKey < key) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Box of the text on the display, from the leftmost pixel of a glyph or the
+ * pen to the rightmost, clipped to 0 - limit.
+ *
+ * @param align widen the box to whole segments.
+ * @param left set to x of the box.
+ * @param width set to the width of the box.
+ * @param origin set to the pen position at the start of the text, relative
+ *        to the box.
+ * @return false if nothing of the text is on the display.
+ */
+bool TextRenderer::_box(
+  uint8_t x, const char* text, bool align, uint8_t limit, uint8_t& left,
+  uint8_t& width, int16_t& origin
+) {
+  int16_t start = 0;
+  int16_t end = 0;
+  int16_t pen = 0;
+  for (const char* c = text; *c != '\0'; c++) {
+    const FontGlyph* glyph = _glyph(*c);
+    if (glyph->width > 0) {
+      if (pen + glyph->left < start) start = pen + glyph->left;
+      if (pen + glyph->left + glyph->width > end) {
+        end = pen + glyph->left + glyph->width;
+      }
+    }
+    pen += glyph->advance + _kerning(c[0], c[1]);
+    if (pen > end) end = pen;
+  }
+  int16_t x0 = x + start;
+  int16_t x1 = x + end;
+  if (x0 < 0) x0 = 0;
+  if (x1 > limit) x1 = limit;
+  if (align) {
+    x0 &= ~1;
+    x1 += x1 % 2;
+  }
+  if (x1 <= x0) return false;
+  left = x0;
+  width = x1 - x0;
+  origin = x - x0;
+  return true;
+}
+
+/**
+ * Render one line of pixels of the text into a line of the box: coverage of
+ * the glyphs, then mapped to the display levels.
+ */
+void TextRenderer::_renderRow(
+  const char* text, int16_t origin, uint8_t row, uint8_t* line,
+  uint8_t width
+) {
+  uint8_t bytes = (width + 1) / 2;
+  memset(line, 0, bytes);
+  int16_t pen = origin;
+  // End of the pixels written so far, glyphs before it are merged.
+  int16_t filled = 0;
+  for (const char* c = text; *c != '\0'; c++) {
+    const FontGlyph* glyph = _glyph(*c);
+    if (row >= glyph->top && row - glyph->top < glyph->height) {
+      int16_t x = pen + glyph->left;
+      const uint8_t* src = _font->atlas + glyph->offset +
+        (uint16_t)(row - glyph->top) * ((glyph->width + 1) / 2);
+      _blitRow(line, width, x, src, glyph->width, filled);
+      if (x + glyph->width > filled) filled = x + glyph->width;
+    }
+    pen += glyph->advance + _kerning(c[0], c[1]);
+  }
+  if (!_mapLevels) return;
+  for (uint8_t i = 0; i < bytes; i++) {
+    line[i] = _levels[line[i] >> 4] << 4 | _levels[line[i] & 0x0f];
+  }
+}
+
+/**
+ * Copy a line of a glyph to x in a line buffer, clipped to its width.
+ * Pixels before filled already hold the previous glyph, the highest coverage
+ * of the two is kept.
+ */
+void TextRenderer::_blitRow(
+  uint8_t* line, uint8_t width, int16_t x, const uint8_t* src,
+  uint8_t count, int16_t filled
+) {
+  uint8_t i = 0;
+  if (x < 0) {
+    if (-x >= count) return;
+    i = -x;
+  }
+  int16_t end = x + count > width ? width : x + count;
+  int16_t dst = x + i;
+  for (; dst < end && dst < filled; dst++, i++) {
+    uint8_t coverage = Nibbles::get(src, i);
+    if (coverage > Nibbles::get(line, dst)) Nibbles::set(line, dst, coverage);
+  }
+  if (dst >= end) return;
+  uint8_t n = end - dst;
+  // Whole bytes in the middle, the half segments at the ends are merged.
+  if (dst % 2) {
+    Nibbles::set(line, dst++, Nibbles::get(src, i++));
+    n--;
+  }
+  Nibbles::copy(line + dst / 2, src, i, n & ~1);
+  if (n % 2) Nibbles::set(line, dst + n - 1, Nibbles::get(src, i + n - 1));
+}
@@ -0,0 +1,87 @@
+/*
+ * Proportional text for the SSD1327 Grayscale driver library.
+ *
+ */
+#ifndef SSD1327_TEXT_H
+#define SSD1327_TEXT_H
+
+// Stack buffer for rendering text straight to the display, lines of the text
+// are sent in chunks of this size. At least a line of the display (64 bytes).
+#ifndef SSD1327_TEXT_BUFFER
+#define SSD1327_TEXT_BUFFER 256
+#endif
+
+#include <stdint.h>
+#include "ssd1327.h"
+#include "ssd1327Font.h"
+#include "ssd1327FrameBuffer.h"
+
+namespace Ssd1327 {
+
+/**
+ * Renders single lines of text in a proportional anti aliased font.
+ *
+ * Text is rendered a line of pixels at a time: the lines of the glyphs in the
+ * atlas are copied into a line buffer a byte at a time (shifted by a nibble
+ * for glyphs at an uneven x), only where a glyph overlaps the one before it
+ * (kerning, overhang) pixels are merged one by one. The line is mapped from
+ * coverage to the foreground and background levels and copied into a frame
+ * buffer or sent to the display.
+ *
+ * Text is opaque: the box from the leftmost to the rightmost pixel of the
+ * text, the full line height, is filled with the background level.
+ */
+class TextRenderer {
+public:
+  TextRenderer(const ProportionalFont* font);
+
+  /**
+   * Set the text and background level, the font is blended between them.
+   * @param foreground 0x0 - 0xf.
+   * @param background 0x0 - 0xf.
+   */
+  void setColors(uint8_t foreground, uint8_t background);
+  /**
+   * Width of text in pixels, the sum of the advances and kerning.
+   */
+  uint16_t measure(const char* text);
+  uint8_t getHeight();
+  /**
+   * Draw text into a frame buffer.
+   * @param x of the pen at the start of the text.
+   * @param y of the top of the line.
+   */
+  void draw(FrameBuffer* frame, uint8_t x, uint8_t y, const char* text);
+  /**
+   * Render text straight to the display, without a frame buffer. The box is
+   * widened to whole segments, so any x works without a shadow buffer.
+   *
+   * @return Status of the transmission, 0 for success.
+   */
+  uint8_t render(
+    Implementation* display, uint8_t x, uint8_t y, const char* text
+  );
+
+private:
+  const ProportionalFont* _font;
+  // Coverage to display level, identity for white on black.
+  uint8_t _levels[16];
+  bool _mapLevels = false;
+
+  const FontGlyph* _glyph(char c);
+  int8_t _kerning(char left, char right);
+  bool _box(
+    uint8_t x, const char* text, bool align, uint8_t limit, uint8_t& left,
+    uint8_t& width, int16_t& origin
+  );
+  void _renderRow(
+    const char* text, int16_t origin, uint8_t row, uint8_t* line,
+    uint8_t width
+  );
+  static void _blitRow(
+    uint8_t* line, uint8_t width, int16_t x, const uint8_t* src,
+    uint8_t count, int16_t filled
+  );
+};
+};
+#endif